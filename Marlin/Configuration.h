@@ -145,7 +145,11 @@
  */
 #define BAUDRATE 115200
 
-//#define BAUD_RATE_GCODE     // Enable G-code M575 to set the baud rate
+#define BAUD_RATE_GCODE     // Enable G-code M575 to set the baud rate
+#if ENABLED(BAUD_RATE_GCODE)
+  #define BAUD_RATE_NEGOTIATION         // M575 N switches only after a CRC-checked test exchange with the host
+  #define BAUD_NEGOTIATION_TIMEOUT 1000 // (ms) Time to wait for each host reply before falling back
+#endif
 
 /**
  * Select a secondary serial port on the board to use for communication with the host.
@@ -2016,7 +2020,7 @@
    * split up moves into short segments like a Delta. This follows the
    * contours of the bed more closely than edge-to-edge straight moves.
    */
-  #define SEGMENT_LEVELED_MOVES
+  //#define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
   /**
@@ -2031,6 +2035,7 @@
     #define G26_XY_FEEDRATE         35    // (mm/s) Feedrate for G26 XY moves.
     #define G26_XY_FEEDRATE_TRAVEL 100    // (mm/s) Feedrate for G26 XY travel moves.
     #define G26_RETRACT_MULTIPLIER   3.0  // G26 Q (retraction) used by default between mesh test elements.
+    #define G26_STREAM_PATTERN            // Stream the pattern to the planner, folding retract/recover into Z lift/drop.
   #endif
 
 #endif
@@ -2044,6 +2049,12 @@
   // Probe along the Y axis, advancing X after each column
   #define PROBE_Y_FIRST
 
+  #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    // Probe the grid in an order with less travel than the zig-zag. Choose one:
+    //#define ABL_HILBERT_CURVE           // Follow a Hilbert curve, as UBL_HILBERT_CURVE does
+    #define ABL_SHORTEST_PROBE_PATH       // Nearest neighbor from the nozzle, improved by 2-opt
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
     // Beyond the probed grid, continue the implied tilt?
@@ -2060,6 +2071,38 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    // Precompute the bilinear coefficients of every (subdivided) grid cell
+    // for a faster Z correction. Uses 16 bytes of SRAM per grid cell.
+    #define BILINEAR_CELL_COEFFICIENTS
+
+    /**
+     * Keep meshes in EEPROM slots, e.g., one per build plate or bed temperature.
+     * 'M420 W<slot>' saves the mesh, tagged with the bed target temperature,
+     * and 'M420 L<slot>' loads it back without probing.
+     */
+    #define BILINEAR_MESH_SLOTS
+    #if ENABLED(BILINEAR_MESH_SLOTS)
+      #define BILINEAR_MESH_SLOT_AUTO_SELECT    // M190 loads the slot saved nearest its target, unless the mesh was just probed or edited
+      #define BILINEAR_MESH_SLOT_TEMP_RANGE 10  // (°C) Only pick a slot saved this close to the target
+    #endif
+
+    /**
+     * Adaptive Mesh. Add 'G29 A' to re-probe only the part of the stored mesh
+     * under the print area, keeping the rest of the full-bed mesh.
+     * The print area is given by G29 L R F B or is read from the ;MINX: ;MINY:
+     * ;MAXX: ;MAXY: header comments of the SD file being printed (e.g., Cura).
+     * The stored mesh must have been probed with the same grid. 'G29 A2' lays
+     * the grid over the print area instead, replacing the full-bed mesh.
+     * The mesh keeps one even grid, so no denser grid is added inside the print
+     * area. For finer detail use more GRID_MAX_POINTS or ABL_BILINEAR_SUBDIVISION.
+     */
+    //#define ABL_ADAPTIVE_MESH
+    #if ENABLED(ABL_ADAPTIVE_MESH)
+      #define ADAPTIVE_MESH_MARGIN         5  // (mm) Extra space around the print area
+      #define ADAPTIVE_MESH_MIN_SPACING   10  // (mm) Minimum grid spacing for a 'G29 A2' print area mesh
+      #define ADAPTIVE_MESH_HEADER_SIZE 2048  // (bytes) Size of the file header to scan for the print area
+    #endif
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
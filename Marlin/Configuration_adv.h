@@ -891,6 +891,7 @@
 //#define HOME_Y_BEFORE_X                     // If G28 contains XY home Y before X
 //#define HOME_Z_FIRST                        // Home Z first. Requires a Z-MIN endstop (not a probe).
 //#define CODEPENDENT_XY_HOMING               // If X/Y can't home without homing Y/X first
+#define CONCURRENT_XY_HOMING                // If G28 contains XY home both at once, each stopping at its own endstop
 
 // @section bltouch
 
@@ -1022,6 +1023,7 @@
   #define G34_MAX_GRADE              5    // (%) Maximum incline that G34 will handle
   #define Z_STEPPER_ALIGN_ITERATIONS 5    // Number of iterations to apply during alignment
   #define Z_STEPPER_ALIGN_ACC        0.02 // Stop iterating early if the accuracy is better than this
+  #define Z_STEPPER_ALIGN_PREDICT         // Fit the correction to the measured deviation to converge in fewer passes
   #define RESTORE_LEVELING_AFTER_G34      // Restore leveling after G34 is done?
   // After G34, re-home Z (G28 Z) or just calculate it from the last probe heights?
   // Re-homing might be more precise in reproducing the actual 'G28 Z' homing height, especially on an uneven bed.
@@ -1183,6 +1185,14 @@
   // to reduce print artifacts. (Enabling this is costly in memory and computation!)
   //#define BACKLASH_SMOOTHING_MM 3 // (mm)
 
+  // Send the correction as a burst of steps from the Stepper ISR when an axis
+  // reverses, instead of adding steps to planner blocks. Leaves block lengths
+  // and junction speeds untouched. (Not compatible with BACKLASH_SMOOTHING_MM.)
+  //#define BACKLASH_IN_STEPPER
+  #if ENABLED(BACKLASH_IN_STEPPER)
+    #define BACKLASH_STEP_RATE 10000 // (steps/s) Rate of correction steps
+  #endif
+
   // Add runtime configuration and tuning of backlash values (M425)
   //#define BACKLASH_GCODE
 
@@ -1496,6 +1506,17 @@
   #endif
 #endif
 
+/**
+ * Print Time Estimator
+ * Read the SD file when it is opened and time every move with the planner's
+ * acceleration, jerk and feedrate settings. The remaining time is set as with
+ * 'M73 R' and is refined by the actual print speed.
+ * The print starts once the whole file has been read.
+ */
+#if BOTH(SDSUPPORT, SET_REMAINING_TIME)
+  #define PRINT_TIME_ESTIMATOR
+#endif
+
 // LCD Print Progress options. Multiple times may be displayed in turn.
 #if HAS_DISPLAY && EITHER(SDSUPPORT, SET_PROGRESS_MANUALLY)
   #define SHOW_PROGRESS_PERCENT           // Show print progress percentage (doesn't affect progress bar)
@@ -1866,10 +1887,21 @@
 
   #define DGUS_RX_BUFFER_SIZE 128
   #define DGUS_TX_BUFFER_SIZE 48
+  #define DGUS_RX_FRAMES      4             // Keep receiving this many frames while a handler is busy
+  #define DGUS_RX_FRAME_SIZE 19             // Bytes kept per frame: VP, word count, and up to 8 data words. Longer frames are dropped.
   //#define SERIAL_STATS_RX_BUFFER_OVERRUNS  // Fix Rx overrun situation (Currently only for AVR)
 
   #define DGUS_UPDATE_INTERVAL_MS  500    // (ms) Interval between automatic screen updates
 
+  #if ENABLED(DGUS_LCD_UI_CREALITY_TOUCH)
+    #define DGUS_VP_SHADOW                // Send only the VPs that changed, merging adjacent VPs into one frame
+    #if ENABLED(DGUS_VP_SHADOW)
+      #define DGUS_VP_SHADOW_SIZE     64  // Number of VPs to remember
+      #define DGUS_BATCH_SIZE         40  // (bytes) Largest merged write. Keep below DGUS_TX_BUFFER_SIZE - 6.
+      #define DGUS_VP_SHADOW_REFRESH 10000 // (ms) Resend everything this often in case the display was reset
+    #endif
+  #endif
+
   #if ANY(DGUS_LCD_UI_FYSETC, DGUS_LCD_UI_MKS, DGUS_LCD_UI_HIPRECY)
     #define DGUS_PRINT_FILENAME           // Display the filename during printing
     #define DGUS_PREHEAT_UI               // Display a preheat screen during heatup
@@ -2091,6 +2123,17 @@
   #if ENABLED(BABYSTEP_ZPROBE_OFFSET)
     //#define BABYSTEP_HOTEND_Z_OFFSET      // For multiple hotends, babystep relative Z offsets
     //#define BABYSTEP_ZPROBE_GFX_OVERLAY   // Enable graphical overlay on Z-offset editor
+
+    /**
+     * Remember where each Z babystep was made, so 'M290 M' can move the
+     * adjustments out of the probe offset and into the bilinear mesh as
+     * local corrections. The mesh is then saved, and Z must be re-homed.
+     */
+    #define BABYSTEP_MESH_FEEDBACK
+    #if ENABLED(BABYSTEP_MESH_FEEDBACK)
+      #define BABYSTEP_MESH_SAMPLES  16     // Locations remembered until applied
+      #define BABYSTEP_MESH_RADIUS   30     // (mm) Smoothing distance. Adjustments closer than half this are merged.
+    #endif
   #endif
 #endif
 
@@ -2279,6 +2322,22 @@
   #endif
 #endif // PTC_PROBE || PTC_BED || PTC_HOTEND
 
+/**
+ * Thermal Z Drift Model
+ *
+ * Fit Z offset as a plane over bed and nozzle temperature from probe samples taken
+ * at different temperatures (M1011 S), then correct Z with babysteps as the temperatures
+ * move away from those at which Z was homed. No table and no G76 calibration is needed.
+ * Requires BABYSTEPPING and a bed probe.
+ */
+#define THERMAL_Z_MODEL
+#if ENABLED(THERMAL_Z_MODEL)
+  #define THERMAL_Z_BED_SLOPE       0.0   // (mm/°C) Default Z shift per °C of bed temperature
+  #define THERMAL_Z_HOTEND_SLOPE    0.0   // (mm/°C) Default Z shift per °C of nozzle temperature
+  #define THERMAL_Z_MAX_CORRECTION  0.5   // (mm) Limit on the applied correction
+  #define THERMAL_Z_UPDATE_MS    1000     // (ms) Interval between corrections
+#endif
+
 // @section extras
 
 //
@@ -2401,6 +2460,21 @@
 #undef BLOCK_BUFFER_SIZE
 #define BLOCK_BUFFER_SIZE 32
 
+/**
+ * Idle Task Scheduler
+ *
+ * Run the idle() subsystem tasks (SD media, display, auto-reports, etc.)
+ * only when they are due, each with its own period, priority and budget.
+ * While the planner is running low the loop returns to the command queue
+ * first, deferring low priority tasks. Report per-task statistics with M1006.
+ */
+#define IDLE_TASK_SCHEDULER
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #define SCHEDULER_LOW_WATER      (BLOCK_BUFFER_SIZE / 2) // (blocks) Fewer planned moves than this and the planner is starving
+  #define SCHEDULER_STARVING_BUDGET 500   // (µs) Time normal priority tasks may take per pass while the planner is starving
+  #define SCHEDULER_MAX_DEFER       200   // (ms) Longest a due task may be deferred
+#endif
+
 // @section serial
 
 // The ASCII buffer for serial input
@@ -2444,6 +2518,17 @@
 // Not supported on all platforms.
 //#define RX_BUFFER_MONITOR
 
+/**
+ * Serial DMA
+ *
+ * Move host and LCD serial data with DMA instead of taking an interrupt
+ * for every byte. Received data is collected on an idle line (or when half
+ * the buffer is filled) and output is sent in chunks from the TX buffer.
+ * The Emergency Parser scans each received chunk.
+ * Supported on STM32F1 (Maple, USART1-3) and LINUX.
+ */
+//#define SERIAL_DMA
+
 /**
  * Emergency Command Parser
  *
@@ -2483,6 +2568,21 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+/**
+ * Windowed Acknowledgements
+ *
+ * A host that sends "M110 N<line> W<count>" may keep up to <count> numbered
+ * lines in flight. Processed lines are acknowledged together with a single
+ * "ok N<last line>" instead of one "ok" per line. After a bad line the
+ * lines that follow it are dropped quietly until the requested line is
+ * resent. Any M110 without W turns the window off. Reported by M115.
+ */
+#define SERIAL_ACK_WINDOW
+#if ENABLED(SERIAL_ACK_WINDOW)
+  #define SERIAL_ACK_WINDOW_MAX 8   // Most lines a host may keep in flight. Should fit in RX_BUFFER_SIZE.
+  #define SERIAL_ACK_INTERVAL   5   // (ms) Longest an acknowledgement is held back
+#endif
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -3103,6 +3203,18 @@
     #define CURRENT_STEP_DOWN     50  // [mA]
     #define REPORT_CURRENT_CHANGE
     #define STOP_ON_ERROR
+
+    /**
+     * Poll TMC2208/TMC2209 UART drivers in the background. Requests are
+     * queued and replies collected from idle() without waiting on the bus,
+     * so status polling doesn't stall the main loop and
+     * MONITOR_DRIVER_STATUS_INTERVAL_MS can be set low to catch
+     * overtemperature early.
+     */
+    #define TMC_UART_ASYNC
+    #if ENABLED(TMC_UART_ASYNC)
+      #define TMC_UART_QUEUE_SIZE 16  // Posted register reads/writes
+    #endif
   #endif
 
   // @section tmc/hybrid
@@ -3139,6 +3251,22 @@
   #define E6_HYBRID_THRESHOLD     30
   #define E7_HYBRID_THRESHOLD     30
 
+  /**
+   * M1010 tunes HYBRID_THRESHOLD and CHOPPER_TIMING of TMC2208/TMC2209
+   * X, Y and Z axes from live driver data. The axis is swept up in speed in
+   * StealthChop until the driver nears its voltage limit and the threshold
+   * is set below that speed. Results are saved to EEPROM.
+   */
+  #define TMC_HYBRID_TUNING
+  #if ENABLED(TMC_HYBRID_TUNING)
+    #define TMC_TUNING_DISTANCE  60   // (mm) Length of the test moves, centered on the axis
+    #define TMC_TUNING_STEPS     10   // Speeds tested, up to the axis max feedrate
+    #define TMC_TUNING_MARGIN   0.8   // Threshold as a fraction of the last good speed
+    #define TMC_TUNING_PWM_LIMIT 250  // PWM_SCALE_SUM this high means no voltage headroom
+    #define TMC_TUNING_SG_LIMIT   10  // SG_RESULT this low means the motor is near stalling
+    #define TMC_TUNING_CHOPPERS { CHOPPER_DEFAULT_24V, CHOPPER_PRUSAMK3_24V, CHOPPER_09STEP_24V, CHOPPER_MARLIN_119 }
+  #endif
+
   /**
    * Use StallGuard to home / probe X, Y, Z.
    *
@@ -3619,6 +3747,17 @@
  */
 #define AUTO_REPORT_POSITION
 
+/**
+ * Stream telemetry with M1009 S<ms> F<format>
+ * Each frame has the stepper positions, planner and queue fill, temperatures,
+ * fan speed, SD file position and state flags, replacing M105/M114/M27 polls.
+ * F0 sends CSV lines, F1 sends binary frames with a CRC16.
+ */
+#define AUTO_REPORT_TELEMETRY
+#if ENABLED(AUTO_REPORT_TELEMETRY)
+  #define TELEMETRY_MIN_INTERVAL 50     // (ms) Shortest interval allowed
+#endif
+
 /**
  * Include capabilities in M115 output
  */
@@ -3694,6 +3833,24 @@
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
 
+/**
+ * G-code command table
+ * Count how often each command in the G-code dispatch table runs.
+ * M1007 lists the commands with their counts and scheduling hints.
+ */
+#define GCODE_COMMAND_TABLE
+
+/**
+ * G-code profiler
+ * Time each command taken from the queue, split into the time spent waiting
+ * on the planner and the time spent computing. Report with M1008.
+ */
+//#define GCODE_PROFILER
+#if ENABLED(GCODE_PROFILER)
+  #define GCODE_PROFILER_SLOTS 32       // Number of different commands to track
+  //#define AUTO_REPORT_GCODE_PROFILE   // Add M1008 S<seconds> to report the profile periodically
+#endif
+
 /**
  * Enable this option for a leaner build of Marlin that removes all
  * workspace offsets, simplifying coordinate transformations, leveling, etc.
@@ -4235,6 +4392,9 @@
 // Enable Tests that will run at startup and produce a report
 //#define MARLIN_TEST_BUILD
 
+// Record the duration of each setup() stage. Report with M1005.
+//#define BOOT_PROFILING
+
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
 
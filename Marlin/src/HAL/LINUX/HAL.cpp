@@ -30,6 +30,48 @@
 
 MSerialT usb_serial(TERN0(EMERGENCY_PARSER, true));
 
+#if ENABLED(SERIAL_DMA)
+
+  /**
+   * Write a received block into the ring buffer as the STM32F1 circular RX DMA
+   * does, publishing it at the half / full transfer points and at the end, as
+   * the DMA and idle-line interrupts do, then scan the new bytes for emergency commands.
+   */
+  void serial_dma_receive(MSerialT &serial, const uint8_t *data, const size_t len) {
+    auto &rb = serial.receive_buffer;
+    const uint16_t pass = rb.size + 1;
+
+    auto update = [&]{
+      const uint16_t end = SerialDMA::rx_end(serial.dma_rx_remaining, rb.size),
+                     count = SerialDMA::rx_count(rb.tail, end, rb.size);
+      if (!count) return;
+      #if ENABLED(EMERGENCY_PARSER)
+        if (serial.emergency_parser_enabled())
+          for (uint16_t i = rb.tail; i != end; i = SerialDMA::wrap(i, 1, rb.size))
+            emergency_parser.update(serial.emergency_state, rb.buf[i]);
+      #endif
+      SerialDMA::rx_publish(rb.head, rb.tail, end, count, rb.size);
+    };
+
+    LOOP_L_N(i, len) {
+      rb.buf[pass - serial.dma_rx_remaining] = data[i];
+      if (!--serial.dma_rx_remaining) serial.dma_rx_remaining = pass;
+      if (serial.dma_rx_remaining == pass || serial.dma_rx_remaining == pass / 2) update();
+    }
+    update();
+  }
+
+  // Take the pending output that runs on without wrapping, up to 'len' bytes, as the STM32F1 TX DMA does
+  size_t serial_dma_transmit(MSerialT &serial, uint8_t *data, const size_t len) {
+    auto &wb = serial.transmit_buffer;
+    const uint16_t n = _MIN(SerialDMA::tx_chunk(wb.head, wb.tail, wb.size), len);
+    LOOP_L_N(i, n) data[i] = wb.buf[wb.head + i];
+    wb.head = SerialDMA::wrap(wb.head, n, wb.size);
+    return n;
+  }
+
+#endif
+
 // U8glib required functions
 extern "C" {
   void u8g_xMicroDelay(uint16_t val) { DELAY_US(val); }
@@ -34,9 +34,19 @@ void sei() { } // Enable
 void _delay_ms(const int ms) { delay(ms); }
 
 uint32_t millis() {
+  #ifdef LINUX_VIRTUAL_TIME
+    Clock::advance(VIRTUAL_CLOCK_READ_NS);
+  #endif
   return (uint32_t)Clock::millis();
 }
 
+uint32_t micros() {
+  #ifdef LINUX_VIRTUAL_TIME
+    Clock::advance(VIRTUAL_CLOCK_READ_NS);
+  #endif
+  return (uint32_t)Clock::micros();
+}
+
 // This is required for some Arduino libraries we are using
 void delayMicroseconds(uint32_t us) {
   Clock::delayMicros(us);
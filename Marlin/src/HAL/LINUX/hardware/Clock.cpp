@@ -24,8 +24,15 @@
 #include "../../../inc/MarlinConfig.h"
 #include "Clock.h"
 
-std::chrono::nanoseconds Clock::startup = std::chrono::high_resolution_clock::now().time_since_epoch();
-uint32_t Clock::frequency = F_CPU;
-double Clock::time_multiplier = 1.0;
+#ifdef LINUX_VIRTUAL_TIME
+  uint64_t Clock::virtual_nanos; // = 0
+  uint32_t Clock::frequency = F_CPU;
+  bool Clock::advancing; // = false
+  Clock::advance_fn *Clock::advance_cb; // = nullptr
+#else
+  std::chrono::nanoseconds Clock::startup = std::chrono::high_resolution_clock::now().time_since_epoch();
+  uint32_t Clock::frequency = F_CPU;
+  double Clock::time_multiplier = 1.0;
+#endif
 
 #endif // __PLAT_LINUX__
@@ -24,66 +24,136 @@
 #include <chrono>
 #include <thread>
 
-class Clock {
-public:
-  static uint64_t ticks(uint32_t frequency = Clock::frequency) {
-    return (Clock::nanos() - Clock::startup.count()) / (1000000000ULL / frequency);
-  }
-
-  static uint64_t nanosToTicks(uint64_t ns, uint32_t frequency = Clock::frequency) {
-    return ns / (1000000000ULL / frequency);
-  }
-
-  // Time acceleration compensated
-  static uint64_t ticksToNanos(uint64_t tick, uint32_t frequency = Clock::frequency) {
-    return (tick * (1000000000ULL / frequency)) / Clock::time_multiplier;
-  }
-
-  static void setFrequency(uint32_t freq) {
-    Clock::frequency = freq;
-  }
-
-  // Time Acceleration compensated
-  static uint64_t nanos() {
-    auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
-    return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
-  }
-
-  static uint64_t micros() {
-    return Clock::nanos() / 1000;
-  }
-
-  static uint64_t millis() {
-    return Clock::micros() / 1000;
-  }
-
-  static double seconds() {
-    return Clock::nanos() / 1000000000.0;
-  }
-
-  static void delayCycles(uint64_t cycles) {
-    std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
-  }
-
-  static void delayMicros(uint64_t micros) {
-    std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
-  }
-
-  static void delayMillis(uint64_t millis) {
-    std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
-  }
-
-  static void delaySeconds(double secs) {
-    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
-  }
-
-  // Will reduce timer resolution increasing likelihood of overflows
-  static void setTimeMultiplier(double tm) {
-    Clock::time_multiplier = tm;
-  }
-
-private:
-  static std::chrono::nanoseconds startup;
-  static uint32_t frequency;
-  static double time_multiplier;
-};
+#ifdef LINUX_VIRTUAL_TIME
+
+  /**
+   * Deterministic virtual time. Time only moves when the firmware delays,
+   * reads the clock, or finishes a pass of the main loop. Timer interrupts
+   * run synchronously at their exact due time, in the firmware thread.
+   */
+
+  // Time charged for each millis() / micros() read, so polling loops progress
+  #ifndef VIRTUAL_CLOCK_READ_NS
+    #define VIRTUAL_CLOCK_READ_NS 100
+  #endif
+  // Time charged for each pass of the main loop
+  #ifndef VIRTUAL_LOOP_NS
+    #define VIRTUAL_LOOP_NS 10000
+  #endif
+
+  class Clock {
+  public:
+    typedef void (advance_fn)(uint64_t until);
+
+    static uint64_t ticks(uint32_t frequency = Clock::frequency) { return nanosToTicks(virtual_nanos, frequency); }
+    static uint64_t nanosToTicks(uint64_t ns, uint32_t frequency = Clock::frequency) { return ns / (1000000000ULL / frequency); }
+    static uint64_t ticksToNanos(uint64_t tick, uint32_t frequency = Clock::frequency) { return tick * (1000000000ULL / frequency); }
+    static void setFrequency(uint32_t freq) { Clock::frequency = freq; }
+
+    static uint64_t nanos()  { return virtual_nanos; }
+    static uint64_t micros() { return nanos() / 1000; }
+    static uint64_t millis() { return micros() / 1000; }
+    static double seconds()  { return nanos() / 1000000000.0; }
+
+    static void delayCycles(uint64_t cycles) { advance(ticksToNanos(cycles)); }
+    static void delayMicros(uint64_t micros) { advance(micros * 1000ULL); }
+    static void delayMillis(uint64_t millis) { advance(millis * 1000000ULL); }
+    static void delaySeconds(double secs)    { advance(uint64_t(secs * 1e9)); }
+
+    static void setTimeMultiplier(double) {} // Virtual time runs as fast as the host can go
+
+    // Called to run interrupts and peripherals up to a point in time
+    static void onAdvance(advance_fn *fn) { advance_cb = fn; }
+
+    /**
+     * Move time forward. From inside an interrupt or peripheral update
+     * time just passes, as it would while the interrupt runs on hardware.
+     */
+    static void advance(const uint64_t ns) {
+      if (advancing || !advance_cb) { virtual_nanos += ns; return; }
+      advancing = true;
+      const uint64_t until = virtual_nanos + ns;
+      advance_cb(until);
+      if (virtual_nanos < until) virtual_nanos = until;
+      advancing = false;
+    }
+
+    // Jump to the due time of an event. Only for the advance callback.
+    static void setNanos(const uint64_t ns) { if (ns > virtual_nanos) virtual_nanos = ns; }
+
+    static bool isAdvancing() { return advancing; }
+
+  private:
+    static uint64_t virtual_nanos;
+    static uint32_t frequency;
+    static bool advancing;
+    static advance_fn *advance_cb;
+  };
+
+#else
+
+  class Clock {
+  public:
+    static uint64_t ticks(uint32_t frequency = Clock::frequency) {
+      return (Clock::nanos() - Clock::startup.count()) / (1000000000ULL / frequency);
+    }
+
+    static uint64_t nanosToTicks(uint64_t ns, uint32_t frequency = Clock::frequency) {
+      return ns / (1000000000ULL / frequency);
+    }
+
+    // Time acceleration compensated
+    static uint64_t ticksToNanos(uint64_t tick, uint32_t frequency = Clock::frequency) {
+      return (tick * (1000000000ULL / frequency)) / Clock::time_multiplier;
+    }
+
+    static void setFrequency(uint32_t freq) {
+      Clock::frequency = freq;
+    }
+
+    // Time Acceleration compensated
+    static uint64_t nanos() {
+      auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
+      return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
+    }
+
+    static uint64_t micros() {
+      return Clock::nanos() / 1000;
+    }
+
+    static uint64_t millis() {
+      return Clock::micros() / 1000;
+    }
+
+    static double seconds() {
+      return Clock::nanos() / 1000000000.0;
+    }
+
+    static void delayCycles(uint64_t cycles) {
+      std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
+    }
+
+    static void delayMicros(uint64_t micros) {
+      std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
+    }
+
+    static void delayMillis(uint64_t millis) {
+      std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
+    }
+
+    static void delaySeconds(double secs) {
+      std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
+    }
+
+    // Will reduce timer resolution increasing likelihood of overflows
+    static void setTimeMultiplier(double tm) {
+      Clock::time_multiplier = tm;
+    }
+
+  private:
+    static std::chrono::nanoseconds startup;
+    static uint32_t frequency;
+    static double time_multiplier;
+  };
+
+#endif // LINUX_VIRTUAL_TIME
@@ -34,8 +34,56 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  #ifdef LINUX_VIRTUAL_TIME
+    due = UINT64_MAX;
+  #endif
 }
 
+#ifdef LINUX_VIRTUAL_TIME
+
+/**
+ * Virtual time timers behave like a hardware timer with auto-reload: the count
+ * restarts when the interrupt fires and the compare value is the period.
+ * Clock::advance() calls fire() when a timer is due.
+ */
+
+Timer::~Timer() {}
+
+void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
+  frequency = sim_freq;
+  cbfn = fn;
+  due = UINT64_MAX;
+}
+
+void Timer::start(uint32_t frequency) {
+  start_time = Clock::nanos();
+  setCompare(this->frequency / frequency);
+}
+
+void Timer::enable() { active = true; }
+
+void Timer::disable() { active = false; }
+
+void Timer::setCompare(uint32_t compare) {
+  this->compare = compare;
+  period = Clock::ticksToNanos(compare, frequency);
+  if (!period) period = 1;
+  due = start_time + period;
+}
+
+void Timer::fire() {
+  start_time = due;
+  due = start_time + period;  // The interrupt may set a new compare
+  Clock::setNanos(start_time);
+  cbfn();
+}
+
+uint32_t Timer::getCount() {
+  return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
+}
+
+#else
+
 Timer::~Timer() {
   timer_delete(timerid);
 }
@@ -114,4 +162,6 @@ uint32_t Timer::getCount() {
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+#endif // LINUX_VIRTUAL_TIME
+
 #endif // __PLAT_LINUX__
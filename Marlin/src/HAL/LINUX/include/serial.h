@@ -30,6 +30,11 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#ifdef LINUX_VIRTUAL_TIME
+  // With no serial thread, send the pending output to stdout right away
+  void virtual_serial_drain();
+#endif
+
 /**
  * Generic RingBuffer
  * T type of the buffer array
@@ -74,6 +79,58 @@ private:
   volatile uint32_t index_read;
 };
 
+#if ENABLED(SERIAL_DMA)
+
+  #include "../../shared/serial_dma.h"
+
+  /**
+   * Ring buffer with the layout of libmaple's, driven by the same
+   * index math as the STM32F1 SERIAL_DMA ports.
+   * S size of the buffer, one byte of which is kept free
+   */
+  template <typename T, uint16_t S> class DMARingBuffer {
+  public:
+    static constexpr uint16_t size = S - 1; // Highest index, as in libmaple
+
+    DMARingBuffer() { head = tail = 0; }
+    uint32_t available() volatile { return SerialDMA::rx_count(head, tail, size); }
+    uint32_t free() volatile      { return size - available(); }
+    bool empty() volatile         { return head == tail; }
+    bool full() volatile          { return available() == size; }
+    void clear() volatile         { head = tail; }
+
+    bool peek(T *value) volatile {
+      if (value == 0 || empty()) return false;
+      *value = buf[head];
+      return true;
+    }
+
+    int read() volatile {
+      if (empty()) return -1;
+      const T value = buf[head];
+      head = SerialDMA::wrap(head, 1, size);
+      return value;
+    }
+
+    bool write(T value) volatile {
+      if (full()) return false;
+      buf[tail] = value;
+      tail = SerialDMA::wrap(tail, 1, size);
+      return true;
+    }
+
+    volatile T buf[S];
+    volatile uint16_t head, tail;
+  };
+
+  #define HAL_SERIAL_BUFFER DMARingBuffer
+
+#else
+
+  #define HAL_SERIAL_BUFFER RingBuffer
+
+#endif
+
 struct HalSerial {
   HalSerial() { host_connected = true; }
 
@@ -89,7 +146,11 @@ struct HalSerial {
 
   size_t write(char c) {
     if (!host_connected) return 0;
-    while (!transmit_buffer.free());
+    #ifdef LINUX_VIRTUAL_TIME
+      if (!transmit_buffer.free()) virtual_serial_drain();
+    #else
+      while (!transmit_buffer.free());
+    #endif
     return transmit_buffer.write(c);
   }
 
@@ -107,12 +168,24 @@ struct HalSerial {
 
   void flushTX() {
     if (host_connected)
-      while (transmit_buffer.available()) { /* nada */ }
+      #ifdef LINUX_VIRTUAL_TIME
+        virtual_serial_drain();
+      #else
+        while (transmit_buffer.available()) { /* nada */ }
+      #endif
   }
 
-  volatile RingBuffer<uint8_t, 128> receive_buffer;
-  volatile RingBuffer<uint8_t, 128> transmit_buffer;
+  volatile HAL_SERIAL_BUFFER<uint8_t, 128> receive_buffer;
+  volatile HAL_SERIAL_BUFFER<uint8_t, 128> transmit_buffer;
   volatile bool host_connected;
+  #if ENABLED(SERIAL_DMA)
+    uint16_t dma_rx_remaining = 128; // Transfers left in the simulated circular RX pass
+  #endif
 };
 
 typedef Serial1Class<HalSerial> MSerialT;
+
+#if ENABLED(SERIAL_DMA)
+  void serial_dma_receive(MSerialT &serial, const uint8_t *data, const size_t len);
+  size_t serial_dma_transmit(MSerialT &serial, uint8_t *data, const size_t len);
+#endif
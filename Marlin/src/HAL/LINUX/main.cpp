@@ -42,9 +42,15 @@ extern void loop();
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
   for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
-    }
+    #if ENABLED(SERIAL_DMA)
+      uint8_t chunk[64];
+      const std::size_t n = serial_dma_transmit(usb_serial, chunk, sizeof(chunk));
+      if (n) fwrite(chunk, 1, n, stdout);
+    #else
+      for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
+        fputc(usb_serial.transmit_buffer.read(), stdout);
+      }
+    #endif
     std::this_thread::yield();
   }
 }
@@ -53,9 +59,14 @@ void read_serial_thread() {
   char buffer[255] = {};
   for (;;) {
     std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
+    if (fgets(buffer, len, stdin)) {
+      #if ENABLED(SERIAL_DMA)
+        serial_dma_receive(usb_serial, (uint8_t*)buffer, strlen(buffer));
+      #else
+        for (std::size_t i = 0; i < strlen(buffer); i++)
+          usb_serial.receive_buffer.write(buffer[i]);
+      #endif
+    }
     std::this_thread::yield();
   }
 }
@@ -105,34 +116,143 @@ void simulation_loop() {
   }
 }
 
-int main() {
-  std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+#ifdef LINUX_VIRTUAL_TIME
+
+  #include "../../gcode/queue.h"
+  #include "../../module/planner.h"
+
+  /**
+   * Deterministic run in virtual time:
+   *
+   *   marlin <gcode file> [<step trace csv>]
+   *
+   * The file is fed to the serial port as fast as the firmware accepts it.
+   * Interrupts and the simulated hardware run at exact virtual instants, so
+   * every run of the same build and file gives the same output and trace.
+   * The trace has one "ns, axis, position" line per step. The program exits
+   * once the file has been read and all commands and moves are done.
+   */
+
+  static Heater *sim_heaters[2];
+
+  void virtual_serial_drain() {
+    #if ENABLED(SERIAL_DMA)
+      uint8_t chunk[64];
+      while (const std::size_t n = serial_dma_transmit(usb_serial, chunk, sizeof(chunk)))
+        fwrite(chunk, 1, n, stdout);
+    #else
+      for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--)
+        fputc(usb_serial.transmit_buffer.read(), stdout);
+    #endif
+  }
+
+  static void virtual_advance(const uint64_t until) {
+    HAL_timer_run_until(until);
+    Clock::setNanos(until);
+    for (Heater *h : sim_heaters) h->update();
+  }
+
+  class StepTraceCSV : public IOLogger {
+  public:
+    StepTraceCSV(const char * const filename, LinearAxis * const (&axes)[4]) : axes(axes) { file = fopen(filename, "w"); }
+    ~StepTraceCSV() { if (file) fclose(file); }
+    void log(GpioEvent ev) {
+      if (!file || ev.event != GpioEvent::RISE) return;
+      LOOP_L_N(i, COUNT(axes))
+        if (ev.pin_id == axes[i]->step_pin)
+          fprintf(file, "%llu, %c, %d\n", (unsigned long long)ev.timestamp, "XYZE"[i], int(axes[i]->position));
+    }
+  private:
+    FILE *file;
+    LinearAxis * const (&axes)[4];
+  };
+
+  int main(int argc, char *argv[]) {
+    if (argc < 2) { fprintf(stderr, "Usage: %s <gcode file> [<step trace csv>]\n", argv[0]); return 1; }
+    FILE * const gcode = fopen(argv[1], "r");
+    if (!gcode) { perror(argv[1]); return 1; }
+
+    Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
+    Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
+    sim_heaters[0] = &hotend;
+    sim_heaters[1] = &bed;
+    LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
+    LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
+    LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
+    LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+    LinearAxis * const axes[4] = { &x_axis, &y_axis, &z_axis, &extruder0 };
+
+    StepTraceCSV trace(argc > 2 ? argv[2] : "/dev/null", axes);
+    if (argc > 2) Gpio::attachLogger(&trace);
 
-  #ifdef MYSERIAL1
     MYSERIAL1.begin(BAUDRATE);
-    SERIAL_ECHOLNPGM("x86_64 Initialized");
-    SERIAL_FLUSHTX();
-  #endif
+    Clock::setFrequency(F_CPU);
+    Clock::onAdvance(virtual_advance);
+    HAL_timer_init();
 
-  Clock::setFrequency(F_CPU);
-  Clock::setTimeMultiplier(1.0); // some testing at 10x
+    const auto wall_start = std::chrono::steady_clock::now();
 
-  HAL_timer_init();
+    setup();
+    bool more = true;
+    for (;;) {
+      loop();
+      Clock::advance(VIRTUAL_LOOP_NS);
 
-  std::thread simulation (simulation_loop);
+      // Feed whole lines while there is room
+      while (more && usb_serial.receive_buffer.free() > MAX_CMD_SIZE) {
+        char line[MAX_CMD_SIZE];
+        if (!fgets(line, sizeof(line), gcode)) { more = false; break; }
+        #if ENABLED(SERIAL_DMA)
+          serial_dma_receive(usb_serial, (uint8_t*)line, strlen(line));
+        #else
+          for (char *c = line; *c; c++) usb_serial.receive_buffer.write(*c);
+        #endif
+      }
 
-  DELAY_US(10000);
+      virtual_serial_drain();
 
-  setup();
-  for (;;) {
-    loop();
-    std::this_thread::yield();
+      if (!more && !usb_serial.receive_buffer.available() && queue.ring_buffer.empty() && !planner.has_blocks_queued())
+        break;
+    }
+
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    fprintf(stderr, "Virtual time %.3fs, wall time %.3fs\n", Clock::seconds(), wall);
+    fclose(gcode);
+    return 0;
   }
 
-  simulation.join();
-  write_serial.join();
-  read_serial.join();
-}
+#else
+
+  int main() {
+    std::thread write_serial (write_serial_thread);
+    std::thread read_serial (read_serial_thread);
+
+    #ifdef MYSERIAL1
+      MYSERIAL1.begin(BAUDRATE);
+      SERIAL_ECHOLNPGM("x86_64 Initialized");
+      SERIAL_FLUSHTX();
+    #endif
+
+    Clock::setFrequency(F_CPU);
+    Clock::setTimeMultiplier(1.0); // some testing at 10x
+
+    HAL_timer_init();
+
+    std::thread simulation (simulation_loop);
+
+    DELAY_US(10000);
+
+    setup();
+    for (;;) {
+      loop();
+      std::this_thread::yield();
+    }
+
+    simulation.join();
+    write_serial.join();
+    read_serial.join();
+  }
+
+#endif // LINUX_VIRTUAL_TIME
 
 #endif // __PLAT_LINUX__
@@ -68,4 +68,19 @@ hal_timer_t HAL_timer_get_count(const uint8_t timer_num) {
   return timers[timer_num].getCount();
 }
 
+#ifdef LINUX_VIRTUAL_TIME
+
+  // Fire every enabled timer that falls due up to 'until', in time order
+  void HAL_timer_run_until(const uint64_t until) {
+    for (;;) {
+      Timer *next = nullptr;
+      for (Timer &t : timers)
+        if (t.enabled() && t.getDue() <= until && (!next || t.getDue() < next->getDue())) next = &t;
+      if (!next) break;
+      next->fire();
+    }
+  }
+
+#endif
+
 #endif // __PLAT_LINUX__
@@ -88,6 +88,10 @@ FORCE_INLINE static void HAL_timer_restrain(const uint8_t timer_num, const uint1
   if (HAL_timer_get_compare(timer_num) < mincmp) HAL_timer_set_compare(timer_num, mincmp);
 }
 
+#ifdef LINUX_VIRTUAL_TIME
+  void HAL_timer_run_until(const uint64_t until);
+#endif
+
 void HAL_timer_enable_interrupt(const uint8_t timer_num);
 void HAL_timer_disable_interrupt(const uint8_t timer_num);
 bool HAL_timer_interrupt_enabled(const uint8_t timer_num);
@@ -37,6 +37,14 @@ static inline __always_inline void my_usart_irq(ring_buffer *rb, ring_buffer *wb
   */
   uint32_t srflags = regs->SR, cr1its = regs->CR1;
 
+  #if ENABLED(SERIAL_DMA)
+    // The line went idle after receiving: collect the bytes the DMA has stored
+    if ((cr1its & USART_CR1_IDLEIE) && (srflags & USART_SR_IDLE)) {
+      regs->DR; // Reading SR then DR clears IDLE
+      serial.dma_rx_update();
+    }
+  #endif
+
   if ((cr1its & USART_CR1_RXNEIE) && (srflags & USART_SR_RXNE)) {
     if (srflags & USART_SR_FE || srflags & USART_SR_PE ) {
       // framing error or parity error
@@ -90,11 +98,145 @@ constexpr bool serial_handles_emergency(int port) {
   ;
 }
 
+#if ENABLED(SERIAL_DMA)
+
+  /**
+   * Start sending the next contiguous chunk of the output buffer.
+   * Called with interrupts off or from the transfer complete interrupt.
+   */
+  void MarlinSerial::dma_tx_start() {
+    ring_buffer * const wb = c_dev()->wb;
+    tx_head = wb->head;
+    tx_len = SerialDMA::tx_chunk(wb->head, wb->tail, wb->size);
+    if (!tx_len) return;
+    dma_disable(DMA1, dma->tx_ch);
+    dma_set_mem_addr(DMA1, dma->tx_ch, &wb->buf[tx_head]);
+    dma_set_num_transfers(DMA1, dma->tx_ch, tx_len);
+    dma_enable(DMA1, dma->tx_ch);
+  }
+
+  // A chunk was sent. Free its space and send the next one.
+  void MarlinSerial::dma_tx_irq() {
+    ring_buffer * const wb = c_dev()->wb;
+    wb->head = SerialDMA::wrap(tx_head, tx_len, wb->size);
+    dma_tx_start();
+  }
+
+  /**
+   * Free the part of the current chunk the DMA has already sent, so a full
+   * buffer takes new output a byte at a time instead of a chunk at a time.
+   */
+  void MarlinSerial::dma_tx_reclaim() {
+    ring_buffer * const wb = c_dev()->wb;
+    CRITICAL_SECTION_START();
+    if (tx_len) wb->head = SerialDMA::wrap(tx_head, tx_len - dma_channel_regs(DMA1, dma->tx_ch)->CNDTR, wb->size);
+    CRITICAL_SECTION_END();
+  }
+
+  // Queue a byte and return. The transfer complete interrupt sends it.
+  size_t MarlinSerial::write(uint8_t c) {
+    if (!dma) return HardwareSerial::write(c);
+    ring_buffer * const wb = c_dev()->wb;
+    while (rb_is_full(wb)) dma_tx_reclaim();
+    rb_insert(wb, c);
+    if (!tx_len) {
+      CRITICAL_SECTION_START();
+      if (!tx_len) dma_tx_start();
+      CRITICAL_SECTION_END();
+    }
+    return 1;
+  }
+
+  /**
+   * Publish the bytes the RX DMA has written since the last update and run
+   * them through the Emergency Parser. Called from the USART idle-line and
+   * the DMA half / full transfer interrupts.
+   */
+  void MarlinSerial::dma_rx_update() {
+    ring_buffer * const rb = c_dev()->rb;
+    const uint16_t end = SerialDMA::rx_end(dma_channel_regs(DMA1, dma->rx_ch)->CNDTR, rb->size),
+                   count = SerialDMA::rx_count(rb->tail, end, rb->size);
+    if (!count) return;
+
+    #if ENABLED(EMERGENCY_PARSER)
+      MSerialT &serial = *static_cast<MSerialT*>(this);
+      if (serial.emergency_parser_enabled())
+        for (uint16_t i = rb->tail; i != end; i = SerialDMA::wrap(i, 1, rb->size))
+          emergency_parser.update(serial.emergency_state, rb->buf[i]);
+    #endif
+
+    SerialDMA::rx_publish(rb->head, rb->tail, end, count, rb->size);
+  }
+
+  void MarlinSerial::begin(uint32 baud, uint8_t config) {
+    HardwareSerial::begin(baud, config);
+    usart_dev * const dev = c_dev();
+    nvic_irq_set_priority(dev->irq_num, UART_IRQ_PRIO);
+    if (!dma) return;
+
+    usart_reg_map * const regs = dev->regs;
+    dma_init(DMA1);
+
+    // Share the USART priority so the RX updates can't preempt each other
+    #define DMA1_IRQ(CH) nvic_irq_num(NVIC_DMA_CH1 + (CH) - DMA_CH1)
+    nvic_irq_set_priority(DMA1_IRQ(dma->rx_ch), UART_IRQ_PRIO);
+    nvic_irq_set_priority(DMA1_IRQ(dma->tx_ch), UART_IRQ_PRIO);
+
+    // RX: circular transfer straight into the ring buffer
+    ring_buffer * const rb = dev->rb;
+    rb->head = rb->tail = 0;
+    dma_disable(DMA1, dma->rx_ch);
+    dma_setup_transfer(DMA1, dma->rx_ch, &regs->DR, DMA_SIZE_8BITS, rb->buf, DMA_SIZE_8BITS, DMA_MINC_MODE | DMA_CIRC_MODE | DMA_HALF_TRNS | DMA_TRNS_CMPLT);
+    dma_set_num_transfers(DMA1, dma->rx_ch, rb->size + 1);
+    dma_set_priority(DMA1, dma->rx_ch, DMA_PRIORITY_HIGH);
+    dma_attach_interrupt(DMA1, dma->rx_ch, dma->rx_irq);
+    dma_enable(DMA1, dma->rx_ch);
+
+    // TX: one chunk of the output ring buffer at a time
+    tx_len = 0;
+    dma_disable(DMA1, dma->tx_ch);
+    dma_setup_transfer(DMA1, dma->tx_ch, &regs->DR, DMA_SIZE_8BITS, dev->wb->buf, DMA_SIZE_8BITS, DMA_MINC_MODE | DMA_FROM_MEM | DMA_TRNS_CMPLT);
+    dma_set_priority(DMA1, dma->tx_ch, DMA_PRIORITY_MEDIUM);
+    dma_attach_interrupt(DMA1, dma->tx_ch, dma->tx_irq);
+
+    // Interrupt only on an idle line instead of every byte
+    regs->CR3 |= USART_CR3_DMAR | USART_CR3_DMAT;
+    regs->CR1 = (regs->CR1 & ~USART_CR1_RXNEIE) | USART_CR1_IDLEIE;
+  }
+
+  // DMA1 channels of USART1-3. UART4-5 have no DMA1 channels and stay interrupt driven.
+  #define SERIAL_DMA_1 4, 5
+  #define SERIAL_DMA_2 7, 6
+  #define SERIAL_DMA_3 2, 3
+
+  // Only the host and LCD ports use DMA
+  #define _DMA_CHANNELS(n, TX, RX) \
+    static void _dma_tx_irq##n(); \
+    static void _dma_rx_irq##n(); \
+    static const MarlinSerial::dma_t _serial_dma##n = { DMA_CH##TX, DMA_CH##RX, _dma_tx_irq##n, _dma_rx_irq##n };
+  #define __DMA_CHANNELS(n, CH) _DMA_CHANNELS(n, CH)
+  #define DEFINE_SERIAL_DMA(n) __DMA_CHANNELS(n, SERIAL_DMA_##n)
+  #define DEFINE_SERIAL_DMA_IRQS(n) \
+    static void _dma_tx_irq##n() { MSerial##n.dma_tx_irq(); } \
+    static void _dma_rx_irq##n() { MSerial##n.dma_rx_update(); }
+  #define SERIAL_DMA_ARG(n) , serial_handles_emergency(n) ? &_serial_dma##n : nullptr
+
+#else
+
+  #define DEFINE_SERIAL_DMA(n)
+  #define DEFINE_SERIAL_DMA_IRQS(n)
+  #define SERIAL_DMA_ARG(n)
+
+#endif
+
 #define DEFINE_HWSERIAL_MARLIN(name, n)     \
+  DEFINE_SERIAL_DMA(n)                      \
   MSerialT name(serial_handles_emergency(n),\
             USART##n,                       \
             BOARD_USART##n##_TX_PIN,        \
-            BOARD_USART##n##_RX_PIN);       \
+            BOARD_USART##n##_RX_PIN         \
+            SERIAL_DMA_ARG(n));             \
+  DEFINE_SERIAL_DMA_IRQS(n)                 \
   extern "C" void __irq_usart##n(void) {    \
     my_usart_irq(USART##n->rb, USART##n->wb, USART##n##_BASE, MSerial##n); \
   }
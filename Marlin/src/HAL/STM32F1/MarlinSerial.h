@@ -31,19 +31,54 @@
 // Increase priority of serial interrupts, to reduce overflow errors
 #define UART_IRQ_PRIO 1
 
+#if ENABLED(SERIAL_DMA)
+  #include <libmaple/dma.h>
+  #include "../shared/serial_dma.h"
+#endif
+
 struct MarlinSerial : public HardwareSerial {
-  MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin) : HardwareSerial(usart_device, tx_pin, rx_pin) { }
-
-  #ifdef UART_IRQ_PRIO
-    // Shadow the parent methods to set IRQ priority after begin()
-    void begin(uint32 baud) {
-      MarlinSerial::begin(baud, SERIAL_8N1);
-    }
-
-    void begin(uint32 baud, uint8_t config) {
-      HardwareSerial::begin(baud, config);
-      nvic_irq_set_priority(c_dev()->irq_num, UART_IRQ_PRIO);
-    }
+  #if ENABLED(SERIAL_DMA)
+    // DMA1 channels and interrupt handlers of a port
+    typedef struct {
+      dma_channel tx_ch, rx_ch;
+      voidFuncPtr tx_irq, rx_irq;
+    } dma_t;
+
+    MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin, const dma_t *dma=nullptr)
+      : HardwareSerial(usart_device, tx_pin, rx_pin), dma(dma) { }
+
+    void begin(uint32 baud) { MarlinSerial::begin(baud, SERIAL_8N1); }
+    void begin(uint32 baud, uint8_t config);
+    size_t write(uint8_t c);
+    using HardwareSerial::write;
+
+    bool uses_dma() const { return dma != nullptr; }
+    void dma_rx_update();
+    void dma_tx_irq();
+
+  private:
+    const dma_t * const dma;
+    volatile uint16_t tx_head, // Output buffer index the chunk being sent starts at
+                      tx_len;  // Length of the chunk being sent, 0 when idle
+    void dma_tx_start();
+    void dma_tx_reclaim();
+
+  #else
+
+    MarlinSerial(struct usart_dev *usart_device, uint8 tx_pin, uint8 rx_pin) : HardwareSerial(usart_device, tx_pin, rx_pin) { }
+
+    #ifdef UART_IRQ_PRIO
+      // Shadow the parent methods to set IRQ priority after begin()
+      void begin(uint32 baud) {
+        MarlinSerial::begin(baud, SERIAL_8N1);
+      }
+
+      void begin(uint32 baud, uint8_t config) {
+        HardwareSerial::begin(baud, config);
+        nvic_irq_set_priority(c_dev()->irq_num, UART_IRQ_PRIO);
+      }
+    #endif
+
   #endif
 };
 
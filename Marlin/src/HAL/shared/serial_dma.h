@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Index math for a serial port that moves its data by DMA through a ring
+ * buffer laid out as libmaple's: 'size' is the highest index (one slot is
+ * kept free), 'head' is read from and 'tail' is written to.
+ *
+ * Used by the STM32F1 SERIAL_DMA ports and by the LINUX HAL that simulates them.
+ */
+
+#include <stdint.h>
+
+struct SerialDMA {
+
+  // The index 'n' places after 'i'
+  static inline uint16_t wrap(const uint16_t i, const uint16_t n, const uint16_t size) {
+    const uint16_t j = i + n;
+    return j > size ? j - (size + 1) : j;
+  }
+
+  // The length of the pending output that runs on from 'head' without wrapping
+  static inline uint16_t tx_chunk(const uint16_t head, const uint16_t tail, const uint16_t size) {
+    return head == tail ? 0 : (tail > head ? tail : size + 1) - head;
+  }
+
+  // The index the circular RX transfer writes next, with 'remaining' transfers left in this pass
+  static inline uint16_t rx_end(const uint16_t remaining, const uint16_t size) {
+    const uint16_t pos = size + 1 - remaining;
+    return pos > size ? 0 : pos;
+  }
+
+  // The number of bytes received from 'tail' up to 'end'
+  static inline uint16_t rx_count(const uint16_t tail, const uint16_t end, const uint16_t size) {
+    return (end + size + 1 - tail) % (size + 1);
+  }
+
+  /**
+   * Publish 'count' received bytes by moving 'tail' to 'end'. As with
+   * rb_push_insert, when the reader has fallen behind the oldest bytes are dropped.
+   */
+  static inline void rx_publish(volatile uint16_t &head, volatile uint16_t &tail, const uint16_t end, const uint16_t count, const uint16_t size) {
+    const uint16_t used = (tail + size + 1 - head) % (size + 1);
+    if (count >= size + 1 - used) head = wrap(end, 1, size);
+    tail = end;
+  }
+
+};
@@ -125,6 +125,26 @@
   #include "feature/bltouch.h"
 #endif
 
+#if ENABLED(BOOT_PROFILING)
+  #include "feature/boot_profile.h"
+#endif
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "feature/print_time_estimator.h"
+#endif
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #include "feature/task_scheduler.h"
+#endif
+
+#if ENABLED(GCODE_PROFILER)
+  #include "feature/gcode_profiler.h"
+#endif
+
+#if ENABLED(AUTO_REPORT_TELEMETRY)
+  #include "feature/telemetry.h"
+#endif
+
 #if ENABLED(BD_SENSOR)
   #include "feature/bedlevel/bdl/bdl.h"
 #endif
@@ -133,6 +153,10 @@
   #include "feature/joystick.h"
 #endif
 
+#if ENABLED(THERMAL_Z_MODEL)
+  #include "feature/thermal_z_model.h"
+#endif
+
 #if HAS_SERVOS
   #include "module/servo.h"
 #endif
@@ -755,6 +779,53 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
   #endif
 }
 
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+  /**
+   * Register the idle() tasks that don't need to run on every pass.
+   * Period in ms, budget in µs. The display and media tasks are low priority
+   * so they never hold up a planner refill for long.
+   */
+  void register_idle_tasks() {
+    #if ENABLED(SDSUPPORT)
+      scheduler.add(PSTR("media"), []{ card.manage_media(); }, 50, TASK_LOW, 200);
+    #endif
+    #if ENABLED(PRINT_TIME_ESTIMATOR)
+      scheduler.add(PSTR("estimator"), []{ print_estimator.task(); }, 1000, TASK_LOW, 200);
+    #endif
+    #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
+      scheduler.add(PSTR("usb_flash"), []{ card.diskIODriver()->idle(); }, 10, TASK_LOW, 500);
+    #endif
+    #if ENABLED(HOST_KEEPALIVE_FEATURE)
+      scheduler.add(PSTR("keepalive"), []{ gcode.host_keepalive(); }, 100, TASK_NORMAL, 200);
+    #endif
+    #if ENABLED(PRINTCOUNTER)
+      scheduler.add(PSTR("job_timer"), []{ print_job_timer.tick(); }, 100, TASK_NORMAL, 500);
+    #endif
+    #if HAS_BEEPER
+      scheduler.add(PSTR("beeper"), []{ buzzer.tick(); }, 0, TASK_HIGH, 50);
+    #endif
+    // The UI guards its own reentry, as when it was called directly from idle()
+    scheduler.add(PSTR("ui"), []{ TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update()); }, 0, TASK_LOW, 1000, true);
+    #if ENABLED(I2C_POSITION_ENCODERS)
+      scheduler.add(PSTR("i2cpem"), []{ if (planner.has_blocks_queued()) I2CPEM.update(); }, I2CPE_MIN_UPD_TIME_MS, TASK_NORMAL, 500);
+    #endif
+    #if HAS_AUTO_REPORTING
+      scheduler.add(PSTR("autoreport"), []{
+        if (gcode.autoreport_paused) return;
+        TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
+        TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
+        TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
+        TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+        TERN_(AUTO_REPORT_GCODE_PROFILE, profiler.auto_reporter.tick());
+        TERN_(AUTO_REPORT_TELEMETRY, telemetry.tick());
+        TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
+      }, 50, TASK_LOW, 500);
+    #endif
+  }
+
+#endif
+
 /**
  * Standard idle routine keeps the machine alive:
  *  - Core Marlin activities
@@ -766,7 +837,9 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
  *  - Run HAL idle tasks
  *  - Handle Power-Loss Recovery
  *  - Run StallGuard endstop checks
+ *  With IDLE_TASK_SCHEDULER the following run only when due:
  *  - Handle SD Card insert / remove
+ *  - Estimate the SD print time
  *  - Handle USB Flash Drive insert / remove
  *  - Announce Host Keepalive state (if any)
  *  - Update the Print Job Timer state
@@ -805,6 +878,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // TODO: Still causing errors
   (void)check_tool_sensor_stats(active_extruder, true);
 
+  // Follow the bed and nozzle temperature with Z
+  TERN_(THERMAL_Z_MODEL, thermal_z.update());
+
   // Handle filament runout sensors
   #if HAS_FILAMENT_SENSOR
     if (TERN1(HAS_PRUSA_MMU2, !mmu2.enabled()))
@@ -828,47 +904,64 @@ void idle(const bool no_stepper_sleep/*=false*/) {
       LOOP_L_N(i, 4) if (endstops.tmc_spi_homing_check()) break; // Read SGT 4 times per idle loop
   #endif
 
-  // Handle SD Card insert / remove
-  TERN_(SDSUPPORT, card.manage_media());
+  // Send the batched acknowledgements that are due, even while a command blocks
+  TERN_(SERIAL_ACK_WINDOW, queue.send_due_acks());
 
-  // Handle USB Flash Drive insert / remove
-  TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
+  #if ENABLED(IDLE_TASK_SCHEDULER)
 
-  // Announce Host Keepalive state (if any)
-  TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
+    // Run the tasks that are due (see register_idle_tasks)
+    scheduler.run();
 
-  // Update the Print Job Timer state
-  TERN_(PRINTCOUNTER, print_job_timer.tick());
+  #else
 
-  // Update the Beeper queue
-  TERN_(HAS_BEEPER, buzzer.tick());
+    // Handle SD Card insert / remove
+    TERN_(SDSUPPORT, card.manage_media());
 
-  // Handle UI input / draw events
-  TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+    // Estimate the print time of the open SD file
+    TERN_(PRINT_TIME_ESTIMATOR, print_estimator.task());
 
-  // Run i2c Position Encoders
-  #if ENABLED(I2C_POSITION_ENCODERS)
-  {
-    static millis_t i2cpem_next_update_ms;
-    if (planner.has_blocks_queued()) {
-      const millis_t ms = millis();
-      if (ELAPSED(ms, i2cpem_next_update_ms)) {
-        I2CPEM.update();
-        i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
+    // Handle USB Flash Drive insert / remove
+    TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
+
+    // Announce Host Keepalive state (if any)
+    TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
+
+    // Update the Print Job Timer state
+    TERN_(PRINTCOUNTER, print_job_timer.tick());
+
+    // Update the Beeper queue
+    TERN_(HAS_BEEPER, buzzer.tick());
+
+    // Handle UI input / draw events
+    TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+
+    // Run i2c Position Encoders
+    #if ENABLED(I2C_POSITION_ENCODERS)
+    {
+      static millis_t i2cpem_next_update_ms;
+      if (planner.has_blocks_queued()) {
+        const millis_t ms = millis();
+        if (ELAPSED(ms, i2cpem_next_update_ms)) {
+          I2CPEM.update();
+          i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
+        }
       }
     }
-  }
-  #endif
+    #endif
+
+    // Auto-report Temperatures / SD Status
+    #if HAS_AUTO_REPORTING
+      if (!gcode.autoreport_paused) {
+        TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
+        TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
+        TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
+        TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+        TERN_(AUTO_REPORT_GCODE_PROFILE, profiler.auto_reporter.tick());
+        TERN_(AUTO_REPORT_TELEMETRY, telemetry.tick());
+        TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
+      }
+    #endif
 
-  // Auto-report Temperatures / SD Status
-  #if HAS_AUTO_REPORTING
-    if (!gcode.autoreport_paused) {
-      TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
-      TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
-      TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
-      TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
-      TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
-    }
   #endif
 
   // Update the Průša MMU2
@@ -1155,16 +1248,21 @@ void setup() {
 
   #if ENABLED(MARLIN_DEV_MODE)
     auto log_current_ms = [&](PGM_P const msg) {
+      TERN_(BOOT_PROFILING, boot_profile.mark(msg));
       SERIAL_ECHO_START();
       SERIAL_CHAR('['); SERIAL_ECHO(millis()); SERIAL_ECHOPGM("] ");
       SERIAL_ECHOLNPGM_P(msg);
     };
     #define SETUP_LOG(M) log_current_ms(PSTR(M))
+  #elif ENABLED(BOOT_PROFILING)
+    #define SETUP_LOG(M) boot_profile.mark(PSTR(M))
   #else
     #define SETUP_LOG(...) NOOP
   #endif
   #define SETUP_RUN(C) do{ SETUP_LOG(STRINGIFY(C)); C; }while(0)
 
+  TERN_(BOOT_PROFILING, boot_profile.mark(PSTR("MYSERIAL1.begin")));
+
   MYSERIAL1.begin(BAUDRATE);
   millis_t serial_connect_timeout = millis() + 1000UL;
   while (!MYSERIAL1.connected() && PENDING(millis(), serial_connect_timeout)) { /*nada*/ }
@@ -1318,6 +1416,12 @@ void setup() {
 
   TERN_(HAS_FANCHECK, fan_check.init());
 
+  // idle() only runs the scheduled tasks, so register them before
+  // anything that may call idle(), starting with the UI.
+  #if ENABLED(IDLE_TASK_SCHEDULER)
+    SETUP_RUN(register_idle_tasks());
+  #endif
+
   // UI must be initialized before EEPROM
   // (because EEPROM code calls the UI).
 
@@ -1622,6 +1726,12 @@ void setup() {
     SETUP_RUN(tft_lvgl_init());
   #endif
 
+  #if ENABLED(SDSUPPORT)
+    // Mount media and check for a power-loss file while the boot screen is up,
+    // rather than after the BOOTSCREEN_TIMEOUT wait in the first idle()
+    SETUP_RUN(card.manage_media());
+  #endif
+
   #if BOTH(HAS_WIRED_LCD, SHOW_BOOTSCREEN)
     const millis_t elapsed = millis() - bootscreen_ms;
     #if ENABLED(MARLIN_DEV_MODE)
@@ -1679,7 +1789,9 @@ void loop() {
       if (marlin_state == MF_SD_COMPLETE) finishSDPrinting();
     #endif
 
+    TERN_(IDLE_TASK_SCHEDULER, scheduler.executing = true);
     queue.advance();
+    TERN_(IDLE_TASK_SCHEDULER, scheduler.executing = false);
 
     #if EITHER(POWER_OFF_TIMER, POWER_OFF_WAIT_FOR_COOLDOWN)
       powerManager.checkAutoPowerOff();
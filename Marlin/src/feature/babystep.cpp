@@ -34,6 +34,14 @@
   #include "../gcode/gcode.h"
 #endif
 
+#if ENABLED(BABYSTEP_MESH_FEEDBACK)
+  #include "bedlevel/bedlevel.h"
+  #include "../module/probe.h"
+  #if ENABLED(EXTENSIBLE_UI)
+    #include "../lcd/extui/ui_api.h"
+  #endif
+#endif
+
 Babystep babystep;
 
 volatile int16_t Babystep::steps[BS_AXIS_IND(Z_AXIS) + 1];
@@ -76,4 +84,79 @@ void Babystep::add_steps(const AxisEnum axis, const int16_t distance) {
   TERN_(INTEGRATED_BABYSTEPPING, if (has_steps()) stepper.initiateBabystepping());
 }
 
+#if ENABLED(BABYSTEP_MESH_FEEDBACK)
+
+  typedef struct { xy_pos_t pos; float z; } z_adjustment_t;
+
+  static z_adjustment_t z_adjustment[BABYSTEP_MESH_SAMPLES];
+  static uint8_t z_adjustment_count;
+  static float z_adjustment_total;      // Moved into the probe offset since the last apply
+
+  uint8_t Babystep::mesh_adjustment_count() { return z_adjustment_count; }
+
+  void Babystep::clear_mesh_adjustments() {
+    z_adjustment_total = 0;
+    z_adjustment_count = 0;
+  }
+
+  void Babystep::record_z_adjustment(const_float_t mm) {
+    z_adjustment_total += mm;
+
+    // Where the nozzle is now, not where the planner will be
+    const xy_pos_t pos = { planner.get_axis_position_mm(X_AXIS), planner.get_axis_position_mm(Y_AXIS) };
+
+    // Touch-ups close together refine the same spot
+    uint8_t i = 0;
+    for (; i < z_adjustment_count; ++i)
+      if ((z_adjustment[i].pos - pos).magnitude() < (BABYSTEP_MESH_RADIUS) * 0.5f) break;
+
+    if (i == z_adjustment_count) {
+      if (z_adjustment_count < COUNT(z_adjustment))
+        z_adjustment_count++;
+      else {
+        // Forget the oldest
+        LOOP_L_N(j, COUNT(z_adjustment) - 1) z_adjustment[j] = z_adjustment[j + 1];
+        i--;
+      }
+    }
+
+    // The whole offset applies here, not just this step
+    z_adjustment[i] = { pos, z_adjustment_total };
+  }
+
+  /**
+   * Spread the recorded offsets over the mesh, each node taking an
+   * inverse-square-distance blend of them, and take the total back out of the
+   * probe offset. A single location shifts the whole mesh, just as the
+   * probe offset did. The Z position no longer accounts for babysteps
+   * already made, so Z must be homed again.
+   */
+  bool Babystep::apply_to_mesh() {
+    if (!z_adjustment_count || !bedlevel.has_mesh()) return false;
+
+    GRID_LOOP(x, y) {
+      if (isnan(bedlevel.z_values[x][y])) continue;
+      const xy_pos_t node = { bedlevel.get_mesh_x(x), bedlevel.get_mesh_y(y) };
+      float wsum = 0, zsum = 0;
+      LOOP_L_N(i, z_adjustment_count) {
+        const xy_pos_t d = z_adjustment[i].pos - node;
+        const float w = 1.0f / (sq(d.x) + sq(d.y) + sq(BABYSTEP_MESH_RADIUS));
+        wsum += w;
+        zsum += w * z_adjustment[i].z;
+      }
+      bedlevel.z_values[x][y] += zsum / wsum;
+      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
+    }
+    bedlevel.refresh_bed_level();
+    TERN_(BILINEAR_MESH_SLOTS, bedlevel.mesh_changed = true);
+
+    probe.offset.z -= z_adjustment_total;
+    clear_mesh_adjustments();
+
+    set_axis_never_homed(Z_AXIS);
+    return true;
+  }
+
+#endif // BABYSTEP_MESH_FEEDBACK
+
 #endif // BABYSTEPPING
@@ -67,6 +67,14 @@ public:
     static void set_mm(const AxisEnum axis, const_float_t mm);
   #endif
 
+  #if ENABLED(BABYSTEP_MESH_FEEDBACK)
+    // Z babysteps that went into the probe offset, and where they were made
+    static void record_z_adjustment(const_float_t mm);
+    static void clear_mesh_adjustments(); // When the mesh or the probe offset is replaced
+    static uint8_t mesh_adjustment_count();
+    static bool apply_to_mesh();
+  #endif
+
   static bool has_steps() {
     return steps[BS_AXIS_IND(X_AXIS)] || steps[BS_AXIS_IND(Y_AXIS)] || steps[BS_AXIS_IND(Z_AXIS)];
   }
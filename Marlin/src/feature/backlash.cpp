@@ -29,8 +29,16 @@
 #include "../module/motion.h"
 #include "../module/planner.h"
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+  #include "../module/stepper.h"
+#endif
+
 axis_bits_t Backlash::last_direction_bits;
-xyz_long_t Backlash::residual_error{0};
+#if ENABLED(BACKLASH_IN_STEPPER)
+  xyz_long_t Backlash::correction_steps{0}, Backlash::pending_steps{0};
+#else
+  xyz_long_t Backlash::residual_error{0};
+#endif
 
 #ifdef BACKLASH_DISTANCE_MM
   #if ENABLED(BACKLASH_GCODE)
@@ -54,6 +62,65 @@ xyz_long_t Backlash::residual_error{0};
 
 Backlash backlash;
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+
+/**
+ * With BACKLASH_IN_STEPPER the planner leaves blocks alone. The Stepper ISR
+ * hands each block over as it starts, and an axis moving in a new direction
+ * queues its backlash distance as correction steps. These are sent in a
+ * rate-limited burst by their own Stepper ISR phase, as with babystepping,
+ * so block lengths and junction speeds are unchanged.
+ */
+
+// Convert the backlash distances to steps. Call whenever an input changes.
+void Backlash::refresh_correction_steps() {
+  const float f_corr = float(correction) / all_on;
+  xyz_long_t steps;
+  LOOP_NUM_AXES(axis) steps[axis] = LROUND(f_corr * distance_mm[axis] * planner.settings.axis_steps_per_mm[axis]);
+  const bool was_enabled = stepper.suspend();
+  correction_steps = steps;
+  if (was_enabled) stepper.wake_up();
+}
+
+// Called by the Stepper ISR as a block starts. Return true if any steps are pending.
+bool Backlash::queue_correction_steps(const block_t * const block) {
+  const axis_bits_t dm = block->direction_bits;
+  axis_bits_t changed_dir = last_direction_bits ^ dm;
+  // Ignore direction change unless steps are taken in that direction
+  LOOP_NUM_AXES(axis) if (!block->steps[axis]) CBI(changed_dir, axis);
+  last_direction_bits ^= changed_dir;
+
+  bool pending = false;
+  LOOP_NUM_AXES(axis) {
+    // Backlash not yet taken up before a reversal cancels part of the new correction
+    if (TEST(changed_dir, axis))
+      pending_steps[axis] += TEST(dm, axis) ? -correction_steps[axis] : correction_steps[axis];
+    if (pending_steps[axis]) pending = true;
+  }
+  return pending;
+}
+
+// Called by the Stepper ISR to take one step on each axis with slack in its current direction
+axis_bits_t Backlash::next_correction_steps(const axis_bits_t dir_bits) {
+  axis_bits_t step_bits = 0;
+  LOOP_NUM_AXES(axis) {
+    const int32_t pending = pending_steps[axis];
+    if (pending && (pending < 0) == TEST(dir_bits, axis)) {
+      pending_steps[axis] += pending < 0 ? 1 : -1;
+      SBI(step_bits, axis);
+    }
+  }
+  return step_bits;
+}
+
+class Backlash::StepAdjuster {
+  public:
+    // After backlash compensation parameter changes, update the steps queued on reversal
+    ~StepAdjuster() { refresh_correction_steps(); }
+};
+
+#else // !BACKLASH_IN_STEPPER
+
 /**
  * To minimize seams in the printed part, backlash correction only adds
  * steps to the current segment (instead of creating a new segment, which
@@ -174,6 +241,8 @@ class Backlash::StepAdjuster {
     }
 };
 
+#endif // !BACKLASH_IN_STEPPER
+
 #if ENABLED(BACKLASH_GCODE)
 
   void Backlash::set_correction_uint8(const uint8_t v) {
@@ -24,13 +24,22 @@
 #include "../inc/MarlinConfigPre.h"
 #include "../module/planner.h"
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+  #define BACKLASH_STEP_TICKS ((STEPPER_TIMER_RATE) / (BACKLASH_STEP_RATE))
+#endif
+
 class Backlash {
 public:
   static constexpr uint8_t all_on = 0xFF, all_off = 0x00;
 
 private:
   static axis_bits_t last_direction_bits;
-  static xyz_long_t residual_error;
+  #if ENABLED(BACKLASH_IN_STEPPER)
+    static xyz_long_t correction_steps, // Steps to take up on each reversal
+                      pending_steps;    // Correction steps not yet sent by the Stepper ISR
+  #else
+    static xyz_long_t residual_error;
+  #endif
 
   #if ENABLED(BACKLASH_GCODE)
     static uint8_t correction;
@@ -72,8 +81,16 @@ public:
     return has_measurement(X_AXIS) || has_measurement(Y_AXIS) || has_measurement(Z_AXIS);
   }
 
-  static void add_correction_steps(const int32_t &da, const int32_t &db, const int32_t &dc, const axis_bits_t dm, block_t * const block);
-  static int32_t get_applied_steps(const AxisEnum axis);
+  #if ENABLED(BACKLASH_IN_STEPPER)
+    // Correction steps are sent outside of blocks, so the stepper position never includes them
+    static int32_t get_applied_steps(const AxisEnum) { return 0; }
+    static void refresh_correction_steps();
+    static bool queue_correction_steps(const block_t * const block);
+    static axis_bits_t next_correction_steps(const axis_bits_t dir_bits);
+  #else
+    static void add_correction_steps(const int32_t &da, const int32_t &db, const int32_t &dc, const axis_bits_t dm, block_t * const block);
+    static int32_t get_applied_steps(const AxisEnum axis);
+  #endif
 
   #if ENABLED(BACKLASH_GCODE)
     static void set_correction_uint8(const uint8_t v);
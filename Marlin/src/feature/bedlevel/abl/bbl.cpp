@@ -35,15 +35,27 @@
   #include "../../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(BILINEAR_MESH_SLOTS)
+  #include "../../../module/planner.h"
+  #include "../../../module/settings.h"
+#endif
+
 LevelingBilinear bedlevel;
 
 xy_pos_t LevelingBilinear::grid_spacing,
          LevelingBilinear::grid_start;
 xy_float_t LevelingBilinear::grid_factor;
 bed_mesh_t LevelingBilinear::z_values;
-xy_pos_t LevelingBilinear::cached_rel;
+#if DISABLED(BILINEAR_CELL_COEFFICIENTS)
+  xy_pos_t LevelingBilinear::cached_rel;
+#endif
 xy_int8_t LevelingBilinear::cached_g;
 
+#if ENABLED(BILINEAR_MESH_SLOTS)
+  int8_t LevelingBilinear::storage_slot = -1;
+  bool LevelingBilinear::mesh_changed; // = false
+#endif
+
 /**
  * Extrapolate a single point from its neighbors
  */
@@ -100,6 +112,10 @@ void LevelingBilinear::extrapolate_one_point(const uint8_t x, const uint8_t y, c
 void LevelingBilinear::reset() {
   grid_start.reset();
   grid_spacing.reset();
+  #if ENABLED(BILINEAR_MESH_SLOTS)
+    storage_slot = -1;
+    mesh_changed = false;
+  #endif
   GRID_LOOP(x, y) {
     z_values[x][y] = NAN;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, 0));
@@ -262,9 +278,39 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values /*= NULL*
 #endif // ABL_BILINEAR_SUBDIVISION
 
 // Refresh after other values have been updated
+#if ENABLED(BILINEAR_MESH_SLOT_AUTO_SELECT)
+
+  /**
+   * Switch to the slot saved at the bed temperature nearest the
+   * target, if one is within BILINEAR_MESH_SLOT_TEMP_RANGE.
+   * A mesh probed or edited since the last load or save is kept.
+   */
+  void LevelingBilinear::select_slot_for_bed(const celsius_t target) {
+    if (mesh_changed) return;
+    int8_t best = -1;
+    celsius_t best_diff = (BILINEAR_MESH_SLOT_TEMP_RANGE) + 1;
+    mesh_slot_t mesh;
+    const int16_t slots = settings.calc_num_meshes();
+    LOOP_L_N(s, slots) {
+      if (!settings.load_mesh(s, &mesh)) continue;
+      const celsius_t diff = ABS(mesh.bed_temp - target);
+      if (diff < best_diff) { best = s; best_diff = diff; }
+    }
+    if (best < 0 || best == storage_slot) return;
+
+    const bool was_active = planner.leveling_active;
+    set_bed_leveling_enabled(false);
+    if (settings.load_mesh(best))
+      SERIAL_ECHO_MSG("Mesh slot ", best, " selected for bed ", target);
+    set_bed_leveling_enabled(was_active);
+  }
+
+#endif
+
 void LevelingBilinear::refresh_bed_level() {
   TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
-  cached_rel.x = cached_rel.y = -999.999;
+  TERN_(BILINEAR_CELL_COEFFICIENTS, calc_cell_coefficients());
+  IF_DISABLED(BILINEAR_CELL_COEFFICIENTS, cached_rel.x = cached_rel.y = -999.999);
   cached_g.x = cached_g.y = -99;
 }
 
@@ -282,89 +328,137 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
-// Get the Z adjustment for non-linear bed leveling
-float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+#if ENABLED(BILINEAR_CELL_COEFFICIENTS)
 
-  static float z1, d2, z3, d4, L, D;
+  LevelingBilinear::cell_coeff_t LevelingBilinear::cell_coeff[ABL_CELLS_X][ABL_CELLS_Y];
 
-  static xy_pos_t ratio;
+  /**
+   * Get the bilinear coefficients of all (virtual) grid cells
+   * so get_z_correction only has to evaluate one polynomial.
+   */
+  void LevelingBilinear::calc_cell_coefficients() {
+    LOOP_L_N(x, ABL_CELLS_X)
+      LOOP_L_N(y, ABL_CELLS_Y) {
+        const float z1 = ABL_BG_GRID(x,     y    ),   // left-front
+                    z2 = ABL_BG_GRID(x,     y + 1),   // left-back
+                    z3 = ABL_BG_GRID(x + 1, y    ),   // right-front
+                    z4 = ABL_BG_GRID(x + 1, y + 1);   // right-back
+        cell_coeff[x][y] = { z1, z3 - z1, z2 - z1, z1 - z2 - z3 + z4 };
+      }
+  }
 
-  // Whole units for the grid line indices. Constrained within bounds.
-  static xy_int8_t thisg, nextg;
+  // Get the Z adjustment for non-linear bed leveling
+  float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
-  // XY relative to the probed area
-  xy_pos_t rel = raw - grid_start.asFloat();
+    // XY relative to the probed area, in grid cell units
+    xy_float_t ratio = { (raw.x - grid_start.x) * ABL_BG_FACTOR(x), (raw.y - grid_start.y) * ABL_BG_FACTOR(y) };
 
-  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
-    #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
-  #else
-    #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
-  #endif
+    // Keep the last cell while the point stays inside it
+    if (!WITHIN(ratio.x - cached_g.x, 0, 1) || !WITHIN(ratio.y - cached_g.y, 0, 1)) {
+      cached_g.x = constrain(FLOOR(ratio.x), 0, ABL_CELLS_X - 1);
+      cached_g.y = constrain(FLOOR(ratio.y), 0, ABL_CELLS_Y - 1);
+    }
 
-  if (cached_rel.x != rel.x) {
-    cached_rel.x = rel.x;
-    ratio.x = rel.x * ABL_BG_FACTOR(x);
-    const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
-    ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
+    ratio.x -= cached_g.x;  // Subtract whole to get the ratio within the cell
+    ratio.y -= cached_g.y;
 
     #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
       // Beyond the grid maintain height at grid edges
-      NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
+      LIMIT(ratio.x, 0, 1);
+      LIMIT(ratio.y, 0, 1);
     #endif
 
-    thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
+    const cell_coeff_t &c = cell_coeff[cached_g.x][cached_g.y];
+    return c.a + c.b * ratio.x + (c.c + c.d * ratio.x) * ratio.y;
   }
 
-  if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
+#else
+
+  // Get the Z adjustment for non-linear bed leveling
+  float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+
+    static float z1, d2, z3, d4, L, D;
 
-    if (cached_rel.y != rel.y) {
-      cached_rel.y = rel.y;
-      ratio.y = rel.y * ABL_BG_FACTOR(y);
-      const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
-      ratio.y -= gy;
+    static xy_pos_t ratio;
+
+    // Whole units for the grid line indices. Constrained within bounds.
+    static xy_int8_t thisg, nextg;
+
+    // XY relative to the probed area
+    xy_pos_t rel = raw - grid_start.asFloat();
+
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+      #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
+    #else
+      #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
+    #endif
+
+    if (cached_rel.x != rel.x) {
+      cached_rel.x = rel.x;
+      ratio.x = rel.x * ABL_BG_FACTOR(x);
+      const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
+      ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
 
       #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
         // Beyond the grid maintain height at grid edges
-        NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
       #endif
 
-      thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      thisg.x = gx;
+      nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
     }
 
-    if (cached_g != thisg) {
-      cached_g = thisg;
-      // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
-    }
+    if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
 
-    // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+      if (cached_rel.y != rel.y) {
+        cached_rel.y = rel.y;
+        ratio.y = rel.y * ABL_BG_FACTOR(y);
+        const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
+        ratio.y -= gy;
 
-    D = R - L;
-  }
+        #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+          // Beyond the grid maintain height at grid edges
+          NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        #endif
+
+        thisg.y = gy;
+        nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      }
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+      if (cached_g != thisg) {
+        cached_g = thisg;
+        // Z at the box corners
+        z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
+        d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
+        z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
+        d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      }
+
+      // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
+                  L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
+      const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
 
-  /*
-  static float last_offset = 0;
-  if (ABS(last_offset - offset) > 0.2) {
-    SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
-    SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
-    SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
-    SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
-    SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
+      D = R - L;
+    }
+
+    const float offset = L + ratio.x * D;   // the offset almost always changes
+
+    /*
+    static float last_offset = 0;
+    if (ABS(last_offset - offset) > 0.2) {
+      SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
+      SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
+      SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
+      SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
+      SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
+    }
+    last_offset = offset;
+    //*/
+
+    return offset;
   }
-  last_offset = offset;
-  //*/
 
-  return offset;
-}
+#endif // !BILINEAR_CELL_COEFFICIENTS
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
@@ -372,9 +466,11 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
   /**
    * Prepare a bilinear-leveled linear move on Cartesian,
-   * splitting the move where it crosses grid borders.
+   * splitting the move only where it crosses grid borders.
+   * The grid lines are visited in order along the move,
+   * so long moves need no recursion or split flags.
    */
-  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits, uint16_t y_splits) {
+  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s) {
     // Get current and destination cells for this line
     xy_int_t c1 { CELL_INDEX(x, current_position.x), CELL_INDEX(y, current_position.y) },
              c2 { CELL_INDEX(x, destination.x), CELL_INDEX(y, destination.y) };
@@ -384,54 +480,36 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     LIMIT(c2.y, 0, ABL_BG_POINTS_Y - 2);
 
     // Start and end in the same cell? No split needed.
-    if (c1 == c2) {
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
-    }
-
-    #define LINE_SEGMENT_END(A) (current_position.A + (destination.A - current_position.A) * normalized_dist)
-
-    float normalized_dist;
-    xyze_pos_t end;
-    const xy_int8_t gc { _MAX(c1.x, c2.x), _MAX(c1.y, c2.y) };
-
-    // Crosses on the X and not already split on this X?
-    // The x_splits flags are insurance against rounding errors.
-    if (c2.x != c1.x && TEST(x_splits, gc.x)) {
-      // Split on the X grid line
-      CBI(x_splits, gc.x);
-      end = destination;
-      destination.x = grid_start.x + ABL_BG_SPACING(x) * gc.x;
-      normalized_dist = (destination.x - current_position.x) / (end.x - current_position.x);
-      destination.y = LINE_SEGMENT_END(y);
-    }
-    // Crosses on the Y and not already split on this Y?
-    else if (c2.y != c1.y && TEST(y_splits, gc.y)) {
-      // Split on the Y grid line
-      CBI(y_splits, gc.y);
-      end = destination;
-      destination.y = grid_start.y + ABL_BG_SPACING(y) * gc.y;
-      normalized_dist = (destination.y - current_position.y) / (end.y - current_position.y);
-      destination.x = LINE_SEGMENT_END(x);
-    }
-    else {
-      // Must already have been split on these border(s)
-      // This should be a rare case.
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
+    if (c1 != c2) {
+      const xyze_pos_t start = current_position;
+      const xyze_float_t dist = destination - start;
+
+      // Direction, remaining grid line crossings, and the next grid line on each axis
+      const xy_int8_t iadd { int8_t(c2.x > c1.x ? 1 : -1), int8_t(c2.y > c1.y ? 1 : -1) };
+      xy_int8_t cnt { int8_t(ABS(c2.x - c1.x)), int8_t(ABS(c2.y - c1.y)) },
+                next { int8_t(c1.x + (iadd.x > 0)), int8_t(c1.y + (iadd.y > 0)) };
+
+      while (cnt.x || cnt.y) {
+        // Fraction of the move where it meets the next X and Y grid lines
+        const float tx = cnt.x ? (grid_start.x + ABL_BG_SPACING(x) * next.x - start.x) / dist.x : 2.0f,
+                    ty = cnt.y ? (grid_start.y + ABL_BG_SPACING(y) * next.y - start.y) / dist.y : 2.0f,
+                    t = _MIN(tx, ty);
+
+        // Step past the nearest line(s). Both when crossing at a grid point.
+        if (tx <= t) { next.x += iadd.x; cnt.x--; }
+        if (ty <= t) { next.y += iadd.y; cnt.y--; }
+
+        // Skip zero-length segments when starting on a grid line
+        if (t <= 0.0f || t >= 1.0f) continue;
+
+        current_position = start + dist * t;
+        line_to_current_position(scaled_fr_mm_s);
+      }
     }
 
-    destination.z = LINE_SEGMENT_END(z);
-    destination.e = LINE_SEGMENT_END(e);
-
-    // Do the split and look for more borders
-    line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
-
-    // Restore destination from stack
-    destination = end;
-    line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+    // The final move ends exactly at the destination
+    current_position = destination;
+    line_to_current_position(scaled_fr_mm_s);
   }
 
 #endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
@@ -30,7 +30,9 @@ public:
 
 private:
   static xy_float_t grid_factor;
-  static xy_pos_t cached_rel;
+  #if DISABLED(BILINEAR_CELL_COEFFICIENTS)
+    static xy_pos_t cached_rel;
+  #endif
   static xy_int8_t cached_g;
 
   static void extrapolate_one_point(const uint8_t x, const uint8_t y, const int8_t xdir, const int8_t ydir);
@@ -49,7 +51,39 @@ private:
     static void bed_level_virt_interpolate();
   #endif
 
+  #if ENABLED(BILINEAR_CELL_COEFFICIENTS)
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+      #define ABL_CELLS_X (ABL_GRID_POINTS_VIRT_X - 1)
+      #define ABL_CELLS_Y (ABL_GRID_POINTS_VIRT_Y - 1)
+    #else
+      #define ABL_CELLS_X GRID_MAX_CELLS_X
+      #define ABL_CELLS_Y GRID_MAX_CELLS_Y
+    #endif
+
+    // Z within a cell = a + b * u + c * v + d * u * v, with u,v from 0 to 1
+    typedef struct { float a, b, c, d; } cell_coeff_t;
+    static cell_coeff_t cell_coeff[ABL_CELLS_X][ABL_CELLS_Y];
+
+    static void calc_cell_coefficients();
+  #endif
+
 public:
+  #if ENABLED(BILINEAR_MESH_SLOTS)
+    // A mesh as kept in an EEPROM slot, tagged with the bed target it was saved at
+    typedef struct {
+      xy_pos_t grid_spacing, grid_start;
+      celsius_t bed_temp;
+      bed_mesh_t z_values;
+    } mesh_slot_t;
+
+    static int8_t storage_slot;   // Slot the mesh came from or went to, -1 for none
+    static bool mesh_changed;     // Probed or edited since the last load or save
+
+    #if ENABLED(BILINEAR_MESH_SLOT_AUTO_SELECT)
+      static void select_slot_for_bed(const celsius_t target);
+    #endif
+  #endif
+
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
   static void extrapolate_unprobed_bed_level();
@@ -63,7 +97,7 @@ public:
   static constexpr float get_z_offset() { return 0.0f; }
 
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s);
   #endif
 };
 
@@ -0,0 +1,126 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/bedlevel/abl/probe_order.cpp - Order of the G29 grid points
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if EITHER(ABL_HILBERT_CURVE, ABL_SHORTEST_PROBE_PATH)
+
+#include "probe_order.h"
+
+#if ENABLED(ABL_HILBERT_CURVE)
+  #include "../hilbert_curve.h"
+#endif
+
+xy_uint8_t ProbeOrder::point[GRID_MAX_POINTS];
+uint8_t ProbeOrder::count;
+
+static void reverse_points(uint8_t i, uint8_t j) {
+  for (; i < j; ++i, --j) {
+    const xy_uint8_t p = ProbeOrder::point[i];
+    ProbeOrder::point[i] = ProbeOrder::point[j];
+    ProbeOrder::point[j] = p;
+  }
+}
+
+#if ENABLED(ABL_HILBERT_CURVE)
+
+  typedef struct {
+    xy_uint8_t wanted[GRID_MAX_POINTS];
+    uint8_t count;
+  } hilbert_filter_t;
+
+  // Take the curve's points in order, keeping only those G29 added
+  static bool hilbert_add(uint8_t x, uint8_t y, void *data) {
+    const hilbert_filter_t &f = *(hilbert_filter_t*)data;
+    LOOP_L_N(i, f.count)
+      if (f.wanted[i].x == x && f.wanted[i].y == y) { ProbeOrder::add(x, y); break; }
+    return false;
+  }
+
+#else
+
+  // XY travel between two probe points
+  static float hop_dist(const xy_pos_t &a, const xy_pos_t &b) { return (b - a).magnitude(); }
+
+#endif
+
+void ProbeOrder::sort(const xy_pos_t &start, const xy_pos_t &origin, const xy_pos_t &spacing) {
+  if (count < 2) return;
+
+  auto pos = [&](const uint8_t i) -> xy_pos_t { return origin + spacing * point[i].asFloat(); };
+
+  #if ENABLED(ABL_HILBERT_CURVE)
+
+    hilbert_filter_t f;
+    f.count = count;
+    LOOP_L_N(i, count) f.wanted[i] = point[i];
+    reset();
+    hilbert_curve::search(hilbert_add, &f);
+
+    // Start from whichever end of the curve is closer
+    if ((pos(count - 1) - start).magnitude() < (pos(0) - start).magnitude())
+      reverse_points(0, count - 1);
+
+  #else
+
+    // Nearest neighbor from the start
+    xy_pos_t here = start;
+    LOOP_L_N(i, count) {
+      uint8_t best = i;
+      float best_d = hop_dist(here, pos(i));
+      for (uint8_t j = i + 1; j < count; ++j) {
+        const float d = hop_dist(here, pos(j));
+        if (d < best_d) { best = j; best_d = d; }
+      }
+      reverse_points(i, best);  // Brings 'best' to 'i'; the order after it is redone anyway
+      here = pos(i);
+    }
+
+    // Undo crossings with 2-opt, keeping the start fixed and the end free
+    auto prev_pos = [&](const uint8_t i) -> xy_pos_t { return i ? pos(i - 1) : start; };
+    LOOP_L_N(pass, 8) {
+      bool improved = false;
+      LOOP_L_N(i, count - 1) {
+        for (uint8_t j = i + 1; j < count; ++j) {
+          const xy_pos_t a = prev_pos(i), b = pos(i), c = pos(j);
+          float delta = hop_dist(a, c) - hop_dist(a, b);
+          if (j < count - 1) {
+            const xy_pos_t d = pos(j + 1);
+            delta += hop_dist(b, d) - hop_dist(c, d);
+          }
+          if (delta < -0.01f) {
+            reverse_points(i, j);
+            improved = true;
+          }
+        }
+      }
+      if (!improved) break;
+    }
+
+  #endif
+}
+
+#endif // ABL_HILBERT_CURVE || ABL_SHORTEST_PROBE_PATH
@@ -0,0 +1,43 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/bedlevel/abl/probe_order.h - Order of the G29 grid points
+ *
+ * G29 adds the grid points it will probe, then probes them in the
+ * order left after sort().
+ */
+
+#include "../../../inc/MarlinConfigPre.h"
+
+class ProbeOrder {
+public:
+  static xy_uint8_t point[GRID_MAX_POINTS];
+  static uint8_t count;
+
+  static void reset() { count = 0; }
+  static void add(const uint8_t x, const uint8_t y) { if (count < COUNT(point)) point[count++].set(x, y); }
+
+  // Reorder the points for the least travel from 'start'
+  static void sort(const xy_pos_t &start, const xy_pos_t &origin, const xy_pos_t &spacing);
+};
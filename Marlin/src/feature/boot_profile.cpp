@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BOOT_PROFILING)
+
+#include "boot_profile.h"
+
+BootProfile boot_profile;
+
+BootProfile::stage_t BootProfile::stages[BOOT_PROFILE_STAGES];
+uint8_t BootProfile::count; // = 0
+
+/**
+ * List the setup() stages with their durations in ms.
+ * The final mark ("setup() completed.") gives the total boot time.
+ */
+void BootProfile::report() {
+  SERIAL_ECHOLNPGM("Boot stages (ms):");
+  LOOP_L_N(i, count) {
+    const stage_t &s = stages[i];
+    SERIAL_ECHOPGM(" [", s.start_ms, "] ");
+    if (i < count - 1) SERIAL_ECHOPGM("+", stages[i + 1].start_ms - s.start_ms, " ");
+    SERIAL_ECHOLNPGM_P(s.name);
+  }
+  if (count == BOOT_PROFILE_STAGES) SERIAL_ECHOLNPGM("(Increase BOOT_PROFILE_STAGES to see all stages.)");
+}
+
+#endif // BOOT_PROFILING
@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/boot_profile.h - Record the duration of each setup() stage
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifndef BOOT_PROFILE_STAGES
+  #define BOOT_PROFILE_STAGES 48
+#endif
+
+class BootProfile {
+private:
+  typedef struct { PGM_P name; millis_t start_ms; } stage_t;
+  static stage_t stages[BOOT_PROFILE_STAGES];
+  static uint8_t count;
+
+public:
+  // Start a new stage, ending the previous one. The last slot is kept for the final mark.
+  static void mark(PGM_P const name) {
+    if (count < BOOT_PROFILE_STAGES) stages[count++] = { name, millis() };
+    else stages[BOOT_PROFILE_STAGES - 1] = { name, millis() };
+  }
+
+  static void report();
+};
+
+extern BootProfile boot_profile;
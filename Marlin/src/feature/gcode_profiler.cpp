@@ -0,0 +1,87 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_PROFILER)
+
+#include "gcode_profiler.h"
+
+GcodeProfiler profiler;
+
+GcodeProfiler::slot_t GcodeProfiler::slots[GCODE_PROFILER_SLOTS];
+uint32_t GcodeProfiler::untracked; // = 0
+bool GcodeProfiler::active; // = false
+uint32_t GcodeProfiler::start_us, GcodeProfiler::wait_us;
+
+#if ENABLED(AUTO_REPORT_GCODE_PROFILE)
+  AutoReporter<GcodeProfiler::AutoReportProfile> GcodeProfiler::auto_reporter;
+#endif
+
+void GcodeProfiler::finish(const char letter, const uint16_t code, const outer_t &outer) {
+  const uint32_t us = micros() - start_us, waited = _MIN(wait_us, us);
+  active = outer.active;
+  start_us = outer.start_us;
+  wait_us = outer.wait_us + waited;
+
+  // Open addressing on the command. Slots are never freed until reset.
+  const uint16_t key = uint16_t(letter) << 10 ^ code;
+  for (uint8_t i = key % (GCODE_PROFILER_SLOTS), n = GCODE_PROFILER_SLOTS; n--;) {
+    slot_t &s = slots[i];
+    if (!s.count) { s.letter = letter; s.code = code; }
+    if (s.letter == letter && s.code == code) {
+      s.count++;
+      s.total_us += us;
+      s.blocked_us += waited;
+      NOLESS(s.max_us, us);
+      return;
+    }
+    if (++i == GCODE_PROFILER_SLOTS) i = 0;
+  }
+  untracked++;
+}
+
+void GcodeProfiler::report() {
+  SERIAL_ECHOLNPGM("G-code profile:");
+  LOOP_L_N(i, GCODE_PROFILER_SLOTS) {
+    const slot_t &s = slots[i];
+    if (!s.count) continue;
+    SERIAL_CHAR(' ', s.letter);
+    SERIAL_ECHO(s.code);
+    SERIAL_ECHOLNPGM(
+      " runs:", s.count,
+      " avg:", uint32_t(s.total_us / s.count),
+      " max:", s.max_us,
+      " total_ms:", uint32_t(s.total_us / 1000),
+      " blocked_ms:", uint32_t(s.blocked_us / 1000),
+      " compute_ms:", uint32_t((s.total_us - s.blocked_us) / 1000)
+    );
+  }
+  if (untracked) SERIAL_ECHOLNPGM(" untracked:", untracked);
+}
+
+void GcodeProfiler::reset() {
+  ZERO(slots);
+  untracked = 0;
+}
+
+#endif // GCODE_PROFILER
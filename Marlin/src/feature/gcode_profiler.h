@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/gcode_profiler.h - Time spent in each G-code handler
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(AUTO_REPORT_GCODE_PROFILE)
+  #include "../libs/autoreport.h"
+#endif
+
+#ifndef GCODE_PROFILER_SLOTS
+  #define GCODE_PROFILER_SLOTS 32
+#endif
+
+class GcodeProfiler {
+private:
+  typedef struct {
+    char letter;
+    uint16_t code;
+    uint32_t count, max_us;
+    uint64_t total_us, blocked_us;
+  } slot_t;
+
+  static slot_t slots[GCODE_PROFILER_SLOTS];
+  static uint32_t untracked;        // Commands that found no free slot
+
+  static bool active;               // A command from the queue is running
+  static uint32_t start_us, wait_us;
+
+public:
+  // Timing of the command a nested one interrupted
+  typedef struct { bool active; uint32_t start_us, wait_us; } outer_t;
+
+  // Around each command taken from the queue. Commands may nest when a
+  // handler drains the queue, so start() hands back the outer timing
+  // and finish() restores it, charging the nested waits to both.
+  static outer_t start() {
+    const outer_t outer = { active, start_us, wait_us };
+    active = true; wait_us = 0; start_us = micros();
+    return outer;
+  }
+  static void finish(const char letter, const uint16_t code, const outer_t &outer);
+
+  // Time the running command spent waiting on the planner
+  static void blocked(const uint32_t us) { if (active) wait_us += us; }
+
+  static void report();
+  static void reset();
+
+  #if ENABLED(AUTO_REPORT_GCODE_PROFILE)
+    struct AutoReportProfile { static void report() { GcodeProfiler::report(); } };
+    static AutoReporter<AutoReportProfile> auto_reporter;
+  #endif
+};
+
+extern GcodeProfiler profiler;
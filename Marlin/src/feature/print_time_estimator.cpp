@@ -0,0 +1,377 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+
+#include "print_time_estimator.h"
+#include "../module/planner.h"
+#include "../module/printcounter.h"
+#include "../lcd/marlinui.h"
+#include "../MarlinCore.h"
+
+PrintTimeEstimator print_estimator;
+
+bool PrintTimeEstimator::done,
+     PrintTimeEstimator::slicer_time;
+uint32_t PrintTimeEstimator::filesize,
+         PrintTimeEstimator::total_ms,
+         PrintTimeEstimator::slice_ms[PRINT_TIME_ESTIMATOR_SLICES];
+float PrintTimeEstimator::frac_ms;
+uint8_t PrintTimeEstimator::slice;
+
+char PrintTimeEstimator::line[MAX_CMD_SIZE];
+uint8_t PrintTimeEstimator::line_len;
+xyze_pos_t PrintTimeEstimator::position;
+feedRate_t PrintTimeEstimator::feedrate_mm_s;
+bool PrintTimeEstimator::relative_mode,
+     PrintTimeEstimator::relative_e;
+float PrintTimeEstimator::acceleration,
+      PrintTimeEstimator::retract_acceleration,
+      PrintTimeEstimator::travel_acceleration;
+
+PrintTimeEstimator::move_t PrintTimeEstimator::pending;
+bool PrintTimeEstimator::has_pending;
+
+uint32_t PrintTimeEstimator::ref_elapsed,
+         PrintTimeEstimator::ref_ms;
+
+/**
+ * Time to cover 'length' with a trapezoid from 'vi' to 'vf' that cruises at 'vn',
+ * split up with the planner's own calculate_trapezoid_for_block math.
+ */
+static float trapezoid_time(const_float_t vi, const_float_t vf, const_float_t vn, const_float_t accel, const_float_t length) {
+  if (vn <= 0) return 0;
+  const float half_inverse_accel = 0.5f / accel,
+              decelerate_mm = Planner::acceleration_distance(vf, vn, half_inverse_accel);
+        float accelerate_mm = Planner::acceleration_distance(vi, vn, half_inverse_accel),
+              cruise = vn;
+  const float plateau_mm = length - accelerate_mm - decelerate_mm;
+
+  // No cruising. Accelerate until the speed where deceleration must begin.
+  if (plateau_mm < 0) {
+    accelerate_mm = constrain(Planner::intersection_distance(length, accelerate_mm, decelerate_mm), 0, length);
+    cruise = Planner::final_speed(vi, accel, accelerate_mm);
+  }
+
+  return (2 * cruise - vi - vf) / accel + _MAX(plateau_mm, 0) / vn;
+}
+
+/**
+ * Read the whole file that was just opened for print and estimate the time
+ * of every move. This runs before the print starts, so it has the file to
+ * itself. The file is rewound for the print when done.
+ */
+void PrintTimeEstimator::start() {
+  stop();
+
+  filesize = card.getFileSize();
+  if (!filesize) return;
+
+  total_ms = 0;
+  frac_ms = 0;
+  slice = 0;
+  line_len = 0;
+  position.reset();
+  feedrate_mm_s = ::feedrate_mm_s;
+  relative_mode = relative_e = false;
+  acceleration = planner.settings.acceleration;
+  retract_acceleration = planner.settings.retract_acceleration;
+  travel_acceleration = planner.settings.travel_acceleration;
+  has_pending = false;
+  ref_elapsed = ref_ms = 0;
+  slicer_time = false;
+
+  uint8_t block[64];
+  uint32_t pos = 0;
+  for (uint16_t blocks = 0;; ++blocks) {
+    const int16_t n = card.read(block, sizeof(block));
+    if (n < 0) return stop();
+
+    for (int16_t i = 0; i < n; ++i) {
+      const char c = block[i];
+      if (c == '\n' || c == '\r') {
+        if (line_len) { line[line_len] = '\0'; process_line(); line_len = 0; }
+      }
+      else if (line_len < sizeof(line) - 1)
+        line[line_len++] = c;
+    }
+
+    pos += n;
+    const bool eof = !n || pos >= filesize;
+    if (eof) {
+      if (line_len) { line[line_len] = '\0'; process_line(); line_len = 0; }
+      flush_pending();
+    }
+
+    // Store the time at the end of each completed slice
+    while (slice < PRINT_TIME_ESTIMATOR_SLICES && (eof || float(pos) * (PRINT_TIME_ESTIMATOR_SLICES) >= float(slice + 1) * filesize))
+      slice_ms[slice++] = total_ms;
+
+    if (eof) break;
+
+    // Keep the heaters, display and host serviced on long files
+    if (!(blocks & 0x3F)) idle();
+  }
+
+  card.setIndex(0);
+  done = true;
+  SERIAL_ECHOLNPGM("Print time estimate: ", total_ms / 1000UL, "s");
+}
+
+void PrintTimeEstimator::stop() {
+  filesize = 0;
+  done = false;
+}
+
+void PrintTimeEstimator::add_time(const_float_t s) {
+  frac_ms += s * 1000.0f;
+  const uint32_t ms = uint32_t(frac_ms);
+  total_ms += ms;
+  frac_ms -= ms;
+}
+
+// Come to a stop at the end of the pending move
+void PrintTimeEstimator::flush_pending() {
+  if (!has_pending) return;
+  add_time(trapezoid_time(pending.entry_speed, 0, pending.nominal_speed, pending.accel, pending.length));
+  has_pending = false;
+}
+
+/**
+ * Add a move to the estimate. Only one move is buffered, so the time of the
+ * previous move is known once the junction speed with this one is known.
+ */
+void PrintTimeEstimator::plan_move(const xyze_pos_t &target, const_float_t arc_mm) {
+  xyz_float_t dist = target - position;
+  const float de = target.e - position.e;
+
+  float length = dist.magnitude();
+  const bool e_only = length < 0.0001f;
+  if (e_only) {
+    if (ABS(de) < 0.0001f) return;
+    length = ABS(de);
+  }
+
+  // Direction of travel for the junction speed. Arcs use the chord.
+  const xyz_float_t unit = e_only ? xyz_float_t({ 0, 0, 0 }) : dist * (1.0f / length);
+  NOLESS(length, arc_mm);
+
+  // Limit the speed and acceleration by each axis, as the planner does
+  float speed = _MAX(feedrate_mm_s, de ? planner.settings.min_feedrate_mm_s : planner.settings.min_travel_feedrate_mm_s),
+        accel = e_only ? retract_acceleration : de ? acceleration : travel_acceleration;
+  LOOP_L_N(i, XYZ) if (dist[i]) {
+    const float ratio = length / ABS(dist[i]);
+    NOMORE(speed, planner.settings.max_feedrate_mm_s[i] * ratio);
+    NOMORE(accel, planner.settings.max_acceleration_mm_per_s2[i] * ratio);
+  }
+  if (de) {
+    const float ratio = length / ABS(de);
+    NOMORE(speed, planner.settings.max_feedrate_mm_s[E_AXIS] * ratio);
+    NOMORE(accel, planner.settings.max_acceleration_mm_per_s2[E_AXIS] * ratio);
+  }
+
+  float junction_speed = 0;
+  if (has_pending) {
+    junction_speed = _MIN(pending.nominal_speed, speed);
+
+    #if HAS_CLASSIC_JERK
+      // Limit the speed change on each axis to the jerk
+      LOOP_L_N(i, XYZ) {
+        const float jump = ABS(pending.unit[i] - unit[i]);
+        if (jump * junction_speed > planner.max_jerk[i]) junction_speed = planner.max_jerk[i] / jump;
+      }
+    #elif HAS_JUNCTION_DEVIATION
+      // Round the corner with the junction deviation
+      const float junction_cos_theta = -(pending.unit.x * unit.x + pending.unit.y * unit.y + pending.unit.z * unit.z);
+      if (junction_cos_theta > 0.999999f)
+        junction_speed = 0;
+      else if (junction_cos_theta > -0.999999f) {
+        const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta));
+        NOMORE(junction_speed, SQRT(accel * planner.junction_deviation_mm * sin_theta_d2 / (1.0f - sin_theta_d2)));
+      }
+    #endif
+
+    // The pending move can't exit faster than it can accelerate to
+    NOMORE(junction_speed, Planner::final_speed(pending.entry_speed, pending.accel, pending.length));
+
+    add_time(trapezoid_time(pending.entry_speed, junction_speed, pending.nominal_speed, pending.accel, pending.length));
+  }
+
+  pending = { length, accel, speed, junction_speed, unit };
+  has_pending = true;
+}
+
+/**
+ * Parse one line of G-code for the commands that take time or change
+ * the motion state. Everything else is ignored.
+ */
+void PrintTimeEstimator::process_line() {
+  char *p = line;
+  while (*p == ' ') p++;
+  if (*p == 'N') { do p++; while (NUMERIC(*p)); while (*p == ' ') p++; } // Skip the line number
+
+  const char letter = *p++;
+  if ((letter != 'G' && letter != 'M') || !NUMERIC(*p)) return;
+  const int16_t codenum = strtol(p, &p, 10);
+  if (*p == '.') return;                                                  // Subcodes don't move
+
+  // Gather the parameters
+  float value[26];
+  uint32_t seen = 0;
+  for (;;) {
+    while (*p == ' ') p++;
+    const char c = *p;
+    if (!c || c == ';' || c == '(' || c == '*') break;
+    p++;
+    if (WITHIN(c, 'A', 'Z')) {
+      char *end;
+      const float v = strtof(p, &end);
+      if (end != p) { value[c - 'A'] = v; SBI(seen, c - 'A'); p = end; }
+    }
+  }
+
+  #define SEEN(C) TEST(seen, C - 'A')
+  #define VALUE(C) value[C - 'A']
+
+  if (letter == 'G') switch (codenum) {
+    case 0: case 1: case 2: case 3: {
+      if (SEEN('F')) feedrate_mm_s = MMM_TO_MMS(VALUE('F'));
+      xyze_pos_t target = position;
+      if (SEEN('X')) target.x = VALUE('X') + (relative_mode ? position.x : 0);
+      if (SEEN('Y')) target.y = VALUE('Y') + (relative_mode ? position.y : 0);
+      if (SEEN('Z')) target.z = VALUE('Z') + (relative_mode ? position.z : 0);
+      if (SEEN('E')) target.e = VALUE('E') + (relative_e ? position.e : 0);
+
+      // Length of an arc given by its radius or center offset, as G2_G3 finds it
+      float arc_mm = 0;
+      if (codenum >= 2) {
+        xy_float_t arc_offset = { 0, 0 };
+        if (SEEN('R')) {
+          const float r = VALUE('R');
+          const xy_pos_t p1 = position, p2 = target;
+          if (r && p1 != p2) {
+            const xy_pos_t d2 = (p2 - p1) * 0.5f;
+            const float e = (codenum == 2) ^ (r < 0) ? -1 : 1,
+                        len = d2.magnitude(),
+                        h2 = (r - len) * (r + len),
+                        h = (h2 >= 0) ? SQRT(h2) : 0.0f;
+            const xy_pos_t s = { -d2.y, d2.x };
+            arc_offset = d2 + s / len * e * h;
+          }
+        }
+        else
+          arc_offset.set(SEEN('I') ? VALUE('I') : 0, SEEN('J') ? VALUE('J') : 0);
+
+        if (arc_offset.x || arc_offset.y) {
+          const xy_float_t r_start = -arc_offset, r_end = xy_float_t(target) - xy_float_t(position) - arc_offset;
+          float angle = ATAN2(r_start.x * r_end.y - r_start.y * r_end.x, r_start.x * r_end.x + r_start.y * r_end.y);
+          if (codenum == 2) angle = -angle;                               // Clockwise
+          if (angle <= 0) angle += RADIANS(360);                          // Same start and end is a full circle
+          arc_mm = angle * r_start.magnitude();
+        }
+      }
+
+      plan_move(target, arc_mm);
+      position = target;
+    } break;
+
+    case 4:                                                               // Dwell
+      flush_pending();
+      add_time(SEEN('S') ? VALUE('S') : SEEN('P') ? VALUE('P') * 0.001f : 0);
+      break;
+
+    case 28:                                                              // Home to 0
+      flush_pending();
+      if (!SEEN('X') && !SEEN('Y') && !SEEN('Z')) position.x = position.y = position.z = 0;
+      if (SEEN('X')) position.x = 0;
+      if (SEEN('Y')) position.y = 0;
+      if (SEEN('Z')) position.z = 0;
+      break;
+
+    case 90: relative_mode = relative_e = false; break;
+    case 91: relative_mode = relative_e = true; break;
+
+    case 92:
+      if (SEEN('X')) position.x = VALUE('X');
+      if (SEEN('Y')) position.y = VALUE('Y');
+      if (SEEN('Z')) position.z = VALUE('Z');
+      if (SEEN('E')) position.e = VALUE('E');
+      break;
+  }
+  else switch (codenum) {
+    case 82: relative_e = false; break;
+    case 83: relative_e = true; break;
+
+    case 204:
+      if (SEEN('S')) acceleration = travel_acceleration = VALUE('S');
+      if (SEEN('P')) acceleration = VALUE('P');
+      if (SEEN('R')) retract_acceleration = VALUE('R');
+      if (SEEN('T')) travel_acceleration = VALUE('T');
+      break;
+
+    case 0: case 1: case 109: case 190: case 191: case 400: case 600:      // Commands that wait for the planner
+      flush_pending();
+      break;
+  }
+}
+
+// Estimated time (ms) to reach a position in the file
+uint32_t PrintTimeEstimator::time_at(const uint32_t pos) {
+  const float f = float(pos) * (PRINT_TIME_ESTIMATOR_SLICES) / filesize;
+  const uint8_t s = _MIN(uint8_t(f), (PRINT_TIME_ESTIMATOR_SLICES) - 1);
+  const uint32_t t0 = s ? slice_ms[s - 1] : 0;
+  return t0 + uint32_t((f - s) * (slice_ms[s] - t0));
+}
+
+/**
+ * The estimated time left, scaled by the actual speed
+ * of the print since the first move was reached.
+ */
+uint32_t PrintTimeEstimator::remaining_time() {
+  if (!done) return 0;
+
+  const uint32_t pos_ms = time_at(card.getIndex()),
+                 elapsed = print_job_timer.duration();
+
+  // Heating is over once the first move is reached
+  if (!ref_ms && pos_ms) { ref_ms = pos_ms; ref_elapsed = elapsed; }
+
+  float scale = 1.0f;
+  const uint32_t estimated = (pos_ms - ref_ms) / 1000UL;
+  if (ref_ms && estimated >= 60) scale = constrain(float(elapsed - ref_elapsed) / estimated, 0.5f, 2.0f);
+
+  return (total_ms > pos_ms ? total_ms - pos_ms : 0) * scale * 0.001f;
+}
+
+/**
+ * Update the remaining time once a second while the estimated file prints,
+ * unless the slicer is sending the remaining time with M73 R.
+ */
+void PrintTimeEstimator::task() {
+  if (!done) return;
+  if (!card.isFileOpen()) return stop();
+  if (!slicer_time && IS_SD_PRINTING()) ui.set_remaining_time(remaining_time());
+}
+
+#endif // PRINT_TIME_ESTIMATOR
@@ -0,0 +1,87 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/print_time_estimator.h - Estimate the print time of the open SD file
+ *
+ * The file is read once when it is opened, before the print starts, and every
+ * move is timed with the planner's trapezoid math using the live acceleration,
+ * jerk / junction deviation and feedrate limits. The time is stored for each
+ * slice of the file, so the remaining time follows the print position and is
+ * corrected by the print speed actually achieved.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../sd/cardreader.h"
+
+#ifndef PRINT_TIME_ESTIMATOR_SLICES
+  #define PRINT_TIME_ESTIMATOR_SLICES 64
+#endif
+
+class PrintTimeEstimator {
+public:
+  static void start();
+  static void stop();
+  static void task();
+
+  static bool ready() { return done; }
+
+  // The slicer's M73 R time takes precedence over the estimate
+  static void slicer_time_received() { slicer_time = true; }
+
+  // Estimated time remaining, in seconds
+  static uint32_t remaining_time();
+
+private:
+  static bool done, slicer_time;
+  static uint32_t filesize, total_ms, slice_ms[PRINT_TIME_ESTIMATOR_SLICES];
+  static float frac_ms;
+  static uint8_t slice;
+
+  // Parser state
+  static char line[MAX_CMD_SIZE];
+  static uint8_t line_len;
+  static xyze_pos_t position;
+  static feedRate_t feedrate_mm_s;
+  static bool relative_mode, relative_e;
+  static float acceleration, retract_acceleration, travel_acceleration;
+
+  // The move waiting for the next junction speed
+  typedef struct {
+    float length, accel, nominal_speed, entry_speed;
+    xyz_float_t unit;
+  } move_t;
+  static move_t pending;
+  static bool has_pending;
+
+  // Speed correction from the actual print progress
+  static uint32_t ref_elapsed, ref_ms;
+
+  static void add_time(const_float_t s);
+  static void flush_pending();
+  static void plan_move(const xyze_pos_t &target, const_float_t arc_mm);
+  static void process_line();
+  static uint32_t time_at(const uint32_t pos);
+};
+
+extern PrintTimeEstimator print_estimator;
@@ -0,0 +1,116 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+#include "task_scheduler.h"
+#include "../module/planner.h"
+
+TaskScheduler scheduler;
+
+bool TaskScheduler::executing; // = false
+TaskScheduler::task_t TaskScheduler::tasks[SCHEDULER_MAX_TASKS];
+uint8_t TaskScheduler::task_count; // = 0
+
+void TaskScheduler::add(PGM_P const name, const task_fn_t fn, const uint16_t period_ms, const TaskPriority priority, const uint16_t budget_us, const bool reentrant/*=false*/) {
+  if (task_count >= SCHEDULER_MAX_TASKS) return;
+  task_t &t = tasks[task_count++];
+  t = { name, fn, period_ms, budget_us, priority, reentrant };
+  t.next_ms = millis();
+}
+
+bool TaskScheduler::planner_starving() {
+  return !executing && planner.has_blocks_queued() && planner.movesplanned() < (SCHEDULER_LOW_WATER);
+}
+
+/**
+ * Run each task that is due, in registration order.
+ * While the planner is starving, low priority tasks and normal priority
+ * tasks that don't fit in the remaining pass budget wait for a later pass,
+ * unless they are already SCHEDULER_MAX_DEFER ms late.
+ */
+void TaskScheduler::run() {
+  const bool starving = planner_starving();
+  const uint32_t pass_us = micros();
+
+  LOOP_L_N(i, task_count) {
+    task_t &t = tasks[i];
+    if (t.running && !t.reentrant) continue;  // idle() called from a blocking wait inside this task
+
+    const millis_t ms = millis();
+    if (PENDING(ms, t.next_ms)) continue;
+
+    if (starving && t.priority != TASK_HIGH && PENDING(ms, t.next_ms + (SCHEDULER_MAX_DEFER))) {
+      if (t.priority == TASK_LOW || micros() - pass_us + t.budget_us > (SCHEDULER_STARVING_BUDGET)) {
+        t.deferrals++;
+        continue;
+      }
+    }
+
+    const bool was_running = t.running;
+    t.running = true;
+    const uint32_t start_us = micros();
+    t.fn();
+    const uint32_t us = micros() - start_us;
+    t.running = was_running;
+
+    t.next_ms = ms + t.period_ms;
+    t.runs++;
+    t.total_us += us;
+    NOLESS(t.max_us, us);
+    if (us > t.budget_us) t.overruns++;
+  }
+}
+
+/**
+ * List the tasks with their settings and run-time statistics
+ */
+void TaskScheduler::report() {
+  SERIAL_ECHOLNPGM("Idle tasks (", planner_starving() ? "starving" : "ok", "):");
+  LOOP_L_N(i, task_count) {
+    const task_t &t = tasks[i];
+    SERIAL_CHAR(' ');
+    SERIAL_ECHOPGM_P(t.name);
+    SERIAL_ECHOLNPGM(
+      " P", t.period_ms, " ", t.priority == TASK_HIGH ? "high" : t.priority == TASK_NORMAL ? "normal" : "low",
+      " B", t.budget_us,
+      " runs:", t.runs,
+      " avg:", t.runs ? uint32_t(t.total_us / t.runs) : 0UL,
+      " max:", t.max_us,
+      " total_ms:", uint32_t(t.total_us / 1000),
+      " over:", t.overruns,
+      " deferred:", t.deferrals
+    );
+  }
+}
+
+void TaskScheduler::reset_stats() {
+  LOOP_L_N(i, task_count) {
+    task_t &t = tasks[i];
+    t.runs = t.max_us = t.overruns = t.deferrals = 0;
+    t.total_us = 0;
+  }
+}
+
+#endif // IDLE_TASK_SCHEDULER
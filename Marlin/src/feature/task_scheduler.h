@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/task_scheduler.h - Run the idle() subsystem tasks when they are due
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifndef SCHEDULER_MAX_TASKS
+  #define SCHEDULER_MAX_TASKS 12
+#endif
+
+enum TaskPriority : uint8_t {
+  TASK_LOW,     // Deferred while the planner is starving (up to SCHEDULER_MAX_DEFER)
+  TASK_NORMAL,  // Run while the planner is starving if its budget fits SCHEDULER_STARVING_BUDGET
+  TASK_HIGH     // Always run when due
+};
+
+class TaskScheduler {
+public:
+  typedef void (*task_fn_t)();
+
+  // Set by loop() while a command is executing. Idle calls from inside a
+  // blocking command can't refill the planner, so nothing is deferred.
+  static bool executing;
+
+private:
+  typedef struct {
+    PGM_P name;
+    task_fn_t fn;
+    uint16_t period_ms, budget_us;
+    TaskPriority priority;
+    bool reentrant, running;
+    millis_t next_ms;
+    uint32_t runs, max_us, overruns, deferrals;
+    uint64_t total_us;
+  } task_t;
+
+  static task_t tasks[SCHEDULER_MAX_TASKS];
+  static uint8_t task_count;
+
+public:
+  // A reentrant task also runs from idle() calls made inside itself, e.g. for a
+  // display that keeps talking while one of its handlers waits on the printer.
+  static void add(PGM_P const name, const task_fn_t fn, const uint16_t period_ms, const TaskPriority priority, const uint16_t budget_us, const bool reentrant=false);
+
+  // The planner is moving but running low, so the loop should get back to queue.advance()
+  static bool planner_starving();
+
+  static void run();
+  static void report();
+  static void reset_stats();
+};
+
+extern TaskScheduler scheduler;
@@ -0,0 +1,120 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(AUTO_REPORT_TELEMETRY)
+
+#include "telemetry.h"
+#include "../MarlinCore.h"
+#include "../gcode/queue.h"
+#include "../libs/crc16.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#include "../module/temperature.h"
+#include "../sd/cardreader.h"
+
+Telemetry telemetry;
+
+uint16_t Telemetry::interval_ms; // = 0
+TelemetryFormat Telemetry::format; // = TELEMETRY_CSV
+millis_t Telemetry::next_ms;
+#if HAS_MULTI_SERIAL
+  SerialMask Telemetry::port_mask = SerialMask::All;
+#endif
+
+void Telemetry::set_interval(const uint16_t ms, const TelemetryFormat fmt) {
+  interval_ms = ms ? _MAX(ms, uint16_t(TELEMETRY_MIN_INTERVAL)) : 0;
+  format = fmt;
+  next_ms = millis() + interval_ms;
+}
+
+void Telemetry::tick() {
+  if (!interval_ms) return;
+  const millis_t ms = millis();
+  if (ELAPSED(ms, next_ms)) {
+    next_ms = ms + interval_ms;
+    PORT_REDIRECT(port_mask);
+    report();
+    PORT_RESTORE();
+  }
+}
+
+void Telemetry::sample(telemetry_frame_t &f) {
+  f.ms = millis();
+  f.axes = LOGICAL_AXES;
+  f.hotends = HOTENDS;
+  LOOP_L_N(a, LOGICAL_AXES) f.position[a] = stepper.position(AxisEnum(a));
+  f.planner_fill = planner.movesplanned();
+  f.queue_fill = queue.ring_buffer.length;
+
+  uint8_t flags = 0;
+  HOTEND_LOOP() {
+    f.hotend[e][0] = int16_t(thermalManager.degHotend(e) * 10);
+    f.hotend[e][1] = thermalManager.degTargetHotend(e) * 10;
+    if (thermalManager.isHeatingHotend(e)) flags |= TLM_HEATING;
+  }
+  #if HAS_HEATED_BED
+    f.bed[0] = int16_t(thermalManager.degBed() * 10);
+    f.bed[1] = thermalManager.degTargetBed() * 10;
+    if (thermalManager.isHeatingBed()) flags |= TLM_HEATING;
+  #else
+    f.bed[0] = f.bed[1] = 0;
+  #endif
+  f.fan = TERN0(HAS_FAN, thermalManager.fan_speed[0]);
+  f.sdpos = TERN0(SDSUPPORT, card.getIndex());
+
+  if (printJobOngoing())            flags |= TLM_PRINTING;
+  if (printingIsPaused())           flags |= TLM_PAUSED;
+  if (IS_SD_PRINTING())             flags |= TLM_SD_PRINTING;
+  if (all_axes_homed())             flags |= TLM_HOMED;
+  if (planner.has_blocks_queued())  flags |= TLM_MOVING;
+  f.flags = flags;
+}
+
+/**
+ * CSV: TLM:ms,axes...,planner,queue,hotend,target...,bed,target,fan,sdpos,flags
+ * Binary: see telemetry_frame_t
+ */
+void Telemetry::report() {
+  telemetry_frame_t f;
+  sample(f);
+
+  if (format == TELEMETRY_BINARY) {
+    uint16_t crc = 0;
+    crc16(&crc, &f, sizeof(f));
+    SERIAL_CHAR(char(0xA5), char(0x5A), char(sizeof(f)));
+    const uint8_t * const p = (const uint8_t*)&f;
+    LOOP_L_N(i, sizeof(f)) SERIAL_CHAR(char(p[i]));
+    SERIAL_CHAR(char(crc & 0xFF), char(crc >> 8));
+    return;
+  }
+
+  SERIAL_ECHOPGM("TLM:", f.ms);
+  LOOP_L_N(a, LOGICAL_AXES) SERIAL_ECHOPGM(",", f.position[a]);
+  SERIAL_ECHOPGM(",", f.planner_fill, ",", f.queue_fill);
+  HOTEND_LOOP() SERIAL_ECHOPGM(",", f.hotend[e][0], ",", f.hotend[e][1]);
+  SERIAL_ECHOLNPGM(",", f.bed[0], ",", f.bed[1], ",", f.fan, ",", f.sdpos, ",", f.flags);
+}
+
+#endif // AUTO_REPORT_TELEMETRY
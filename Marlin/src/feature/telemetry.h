@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/telemetry.h - Stream the machine state in one compact frame
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifndef TELEMETRY_MIN_INTERVAL
+  #define TELEMETRY_MIN_INTERVAL 50
+#endif
+
+enum TelemetryFormat : uint8_t { TELEMETRY_CSV, TELEMETRY_BINARY };
+
+enum TelemetryFlag : uint8_t {
+  TLM_PRINTING    = _BV(0), // A print job is running
+  TLM_PAUSED      = _BV(1), // The print job is paused
+  TLM_SD_PRINTING = _BV(2), // Printing from the SD card
+  TLM_HOMED       = _BV(3), // All axes are homed
+  TLM_MOVING      = _BV(4), // The planner has moves queued
+  TLM_HEATING     = _BV(5)  // A heater is still working towards its target
+};
+
+/**
+ * Binary frame, all values little-endian:
+ *   0xA5 0x5A, payload length, payload, CRC16 of the payload
+ */
+typedef struct {
+  uint32_t ms;                      // millis() when the frame was taken
+  uint8_t axes, hotends;            // Counts, so a host can decode the frame
+  int32_t position[LOGICAL_AXES];   // Stepper position in steps
+  uint8_t planner_fill, queue_fill; // Blocks in the planner, commands in the queue
+  int16_t hotend[HOTENDS][2];       // Current and target temperature, in 0.1°C
+  int16_t bed[2];                   // Current and target bed temperature, in 0.1°C
+  uint8_t fan;                      // First fan speed, 0-255
+  uint32_t sdpos;                   // Position in the SD file being printed
+  uint8_t flags;                    // TelemetryFlag bits
+} __attribute__((packed)) telemetry_frame_t;
+
+class Telemetry {
+public:
+  static uint16_t interval_ms;      // 0 when disabled
+  static TelemetryFormat format;
+
+  #if HAS_MULTI_SERIAL
+    static SerialMask port_mask;    // Where M1009 came from
+  #endif
+
+  static void set_interval(const uint16_t ms, const TelemetryFormat fmt);
+  static void tick();
+  static void report();
+
+private:
+  static millis_t next_ms;
+  static void sample(telemetry_frame_t &f);
+};
+
+extern Telemetry telemetry;
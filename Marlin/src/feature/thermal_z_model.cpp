@@ -0,0 +1,109 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/thermal_z_model.cpp - Z drift from bed and nozzle temperature
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(THERMAL_Z_MODEL)
+
+#include "thermal_z_model.h"
+#include "babystep.h"
+#include "../module/endstops.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+
+ThermalZModel thermal_z;
+
+thermal_z_settings_t ThermalZModel::settings;
+linear_fit_data ThermalZModel::samples;
+celsius_float_t ThermalZModel::ref_bed, ThermalZModel::ref_hotend;
+int32_t ThermalZModel::applied_steps, ThermalZModel::base_steps;
+bool ThermalZModel::referenced;
+
+void ThermalZModel::reset() {
+  settings.enabled = true;
+  settings.bed_slope = THERMAL_Z_BED_SLOPE;
+  settings.hotend_slope = THERMAL_Z_HOTEND_SLOPE;
+  clear_samples();
+}
+
+void ThermalZModel::add_sample(const celsius_float_t bed, const celsius_float_t hotend, const_float_t z) {
+  // Babysteps already applied shift the probed Z by the same amount
+  incremental_LSF(&samples, bed, hotend, z + correction());
+}
+
+bool ThermalZModel::fit() {
+  // Bed and nozzle must not have changed in lockstep, or the two can't be told apart
+  if (finish_incremental_LSF(&samples)) return false;
+
+  // The fitted plane is z = -(A * bed + B * hotend + D)
+  settings.bed_slope = -samples.A;
+  settings.hotend_slope = -samples.B;
+  return true;
+}
+
+void ThermalZModel::set_reference() {
+  ref_bed = thermalManager.degBed();
+  ref_hotend = thermalManager.degHotend(0);
+  applied_steps = base_steps = 0;
+  referenced = true;
+}
+
+void ThermalZModel::set_mesh_reference() {
+  ref_bed = thermalManager.degBed();
+  ref_hotend = thermalManager.degHotend(0);
+  base_steps = applied_steps;
+}
+
+float ThermalZModel::correction() { return applied_steps * planner.mm_per_step[Z_AXIS]; }
+
+/**
+ * Called from idle() after thermalManager.task()
+ */
+void ThermalZModel::update() {
+  static millis_t next_update_ms = 0;
+  const millis_t ms = millis();
+  if (PENDING(ms, next_update_ms)) return;
+  next_update_ms = ms + THERMAL_Z_UPDATE_MS;
+
+  // Hold still while probing, so measurements aren't shifted under the probe
+  if (!settings.enabled || !referenced || !axis_is_trusted(Z_AXIS) || endstops.z_probe_enabled) return;
+
+  float shift = base_steps * planner.mm_per_step[Z_AXIS]
+              + settings.bed_slope * (thermalManager.degBed() - ref_bed)
+              + settings.hotend_slope * (thermalManager.degHotend(0) - ref_hotend);
+  LIMIT(shift, -(THERMAL_Z_MAX_CORRECTION), THERMAL_Z_MAX_CORRECTION);
+
+  // A surface that rose with temperature needs the nozzle raised by the same amount
+  const int32_t target_steps = LROUND(shift * planner.settings.axis_steps_per_mm[Z_AXIS]);
+  const int16_t steps = target_steps - applied_steps;
+  if (steps) {
+    babystep.add_steps(Z_AXIS, steps);
+    applied_steps = target_steps;
+  }
+}
+
+#endif // THERMAL_Z_MODEL
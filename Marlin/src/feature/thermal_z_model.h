@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/thermal_z_model.h - Z drift from bed and nozzle temperature
+ *
+ * Probe samples taken at different temperatures are fitted to a plane
+ * z = f(bed °C, nozzle °C). While enabled, the change in the model since
+ * Z was homed, or since the mesh was probed, is applied as Z babysteps.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/least_squares_fit.h"
+
+typedef struct {
+  bool enabled;
+  float bed_slope, hotend_slope;    // (mm/°C)
+} thermal_z_settings_t;
+
+class ThermalZModel {
+public:
+  static thermal_z_settings_t settings;
+
+  static void reset();
+
+  // Fit data, not saved
+  static void clear_samples() { incremental_LSF_reset(&samples); }
+  static uint16_t sample_count() { return uint16_t(samples.N); }
+  static void add_sample(const celsius_float_t bed, const celsius_float_t hotend, const_float_t z);
+  static bool fit();    // Replace the slopes with the fitted ones
+
+  // Z was homed at the current temperatures
+  static void set_reference();
+
+  // A mesh was probed or loaded at the current temperatures. Its heights
+  // already include the drift so far, so only later drift is corrected.
+  static void set_mesh_reference();
+
+  // The correction applied since Z was homed (mm)
+  static float correction();
+
+  static void update();
+
+private:
+  static linear_fit_data samples;
+  static celsius_float_t ref_bed, ref_hotend;
+  static int32_t applied_steps, base_steps;
+  static bool referenced;
+};
+
+extern ThermalZModel thermal_z;
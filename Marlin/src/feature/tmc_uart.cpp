@@ -0,0 +1,147 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/tmc_uart.cpp
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TMC_UART_ASYNC)
+
+#include "tmc_uart.h"
+
+#define TMC_UART_SYNC        0x05
+#define TMC_UART_MASTER_ADDR 0xFF
+#define TMC_UART_WRITE       0x80
+#define TMC_UART_TIMEOUT_MS  10     // Enough for a reply at 19200 baud
+#define TMC_UART_RETRIES     2
+
+TMCUartQueue tmc_uart;
+
+TMCUartQueue::transaction_t TMCUartQueue::queue[TMC_UART_QUEUE_SIZE];
+uint8_t TMCUartQueue::head, TMCUartQueue::count, TMCUartQueue::retries, TMCUartQueue::received;
+uint8_t TMCUartQueue::reply[8];
+bool TMCUartQueue::waiting;
+millis_t TMCUartQueue::timeout_ms;
+
+// CRC8 with polynomial 0x07, bits taken LSB first (TMC220x datasheet)
+uint8_t TMCUartQueue::crc8(const uint8_t * const data, const uint8_t len) {
+  uint8_t crc = 0;
+  LOOP_L_N(i, len) {
+    uint8_t b = data[i];
+    LOOP_L_N(j, 8) {
+      crc = ((crc >> 7) ^ (b & 0x01)) ? (crc << 1) ^ 0x07 : crc << 1;
+      b >>= 1;
+    }
+  }
+  return crc;
+}
+
+bool TMCUartQueue::post(TMCUartLink &link, const uint8_t reg, const uint32_t value, const bool write, const tmc_uart_cb_t cb) {
+  if (count >= TMC_UART_QUEUE_SIZE) return false;
+  transaction_t &t = queue[(head + count) % TMC_UART_QUEUE_SIZE];
+  t.link = &link;
+  t.cb = cb;
+  t.value = value;
+  t.reg = reg;
+  t.write = write;
+  count++;
+  return true;
+}
+
+bool TMCUartQueue::read(TMCUartLink &link, const uint8_t reg, const tmc_uart_cb_t cb) {
+  return post(link, reg, 0, false, cb);
+}
+
+// Note: TMCStepper keeps shadow copies of some registers, which this doesn't update
+bool TMCUartQueue::write(TMCUartLink &link, const uint8_t reg, const uint32_t value, const tmc_uart_cb_t cb/*=nullptr*/) {
+  return post(link, reg, value, true, cb);
+}
+
+void TMCUartQueue::start(const transaction_t &t) {
+  TMCUartLink &link = *t.link;
+  if (t.write) {
+    uint8_t datagram[8] = {
+      TMC_UART_SYNC, link.uart_address(), uint8_t(t.reg | TMC_UART_WRITE),
+      uint8_t(t.value >> 24), uint8_t(t.value >> 16), uint8_t(t.value >> 8), uint8_t(t.value), 0
+    };
+    datagram[7] = crc8(datagram, 7);
+    link.uart_send(datagram, sizeof(datagram));
+  }
+  else {
+    uint8_t datagram[4] = { TMC_UART_SYNC, link.uart_address(), t.reg, 0 };
+    datagram[3] = crc8(datagram, 3);
+    link.uart_listen(true);
+    while (link.uart_read() >= 0) { /* drop stale bytes */ }
+    link.uart_send(datagram, sizeof(datagram));
+    received = 0;
+    waiting = true;
+    timeout_ms = millis() + TMC_UART_TIMEOUT_MS;
+  }
+}
+
+void TMCUartQueue::finish(const bool ok, const uint32_t value) {
+  const transaction_t t = queue[head];
+  if (waiting) { t.link->uart_listen(false); waiting = false; }
+  head = (head + 1) % TMC_UART_QUEUE_SIZE;
+  count--;
+  retries = 0;
+  if (t.cb) t.cb(*t.link, t.reg, value, ok);
+}
+
+void TMCUartQueue::service() {
+  while (count) {
+    const transaction_t &t = queue[head];
+
+    if (!waiting) {
+      start(t);
+      if (t.write) { finish(true, t.value); continue; }
+    }
+
+    // Collect the reply, skipping the echo of the request on single-wire setups
+    const uint8_t header[3] = { TMC_UART_SYNC, TMC_UART_MASTER_ADDR, t.reg };
+    for (int16_t c; received < sizeof(reply) && (c = t.link->uart_read()) >= 0;) {
+      reply[received++] = c;
+      if (received <= COUNT(header) && reply[received - 1] != header[received - 1])
+        received = (c == TMC_UART_SYNC) ? (reply[0] = c, 1) : 0;
+    }
+
+    if (received == sizeof(reply) && reply[7] == crc8(reply, 7)) {
+      finish(true, uint32_t(reply[3]) << 24 | uint32_t(reply[4]) << 16 | uint32_t(reply[5]) << 8 | reply[6]);
+      continue;
+    }
+
+    if (received < sizeof(reply) && PENDING(millis(), timeout_ms)) return; // Still waiting
+
+    // Timed out or bad CRC
+    t.link->uart_listen(false);
+    waiting = false;
+    if (++retries > TMC_UART_RETRIES) finish(false, 0);
+  }
+}
+
+void TMCUartQueue::sync() {
+  while (count) service();
+}
+
+#endif // TMC_UART_ASYNC
@@ -0,0 +1,88 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/tmc_uart.h
+ *
+ * Non-blocking register access for TMC2208/TMC2209 UART drivers.
+ * Transactions are posted to a queue and carried out from idle(), one at a
+ * time since drivers share the bus, without waiting for the reply to arrive.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class TMCUartLink;
+
+// Called when a transaction completes. 'ok' is false if the driver never answered.
+typedef void (*tmc_uart_cb_t)(TMCUartLink &link, const uint8_t reg, const uint32_t value, const bool ok);
+
+/**
+ * Raw access to the serial port of a driver, implemented by TMCMarlin
+ * on top of the TMCStepper port handling
+ */
+class TMCUartLink {
+  public:
+    virtual uint8_t uart_address() = 0;
+    virtual void uart_send(const uint8_t * const data, const uint8_t len) = 0;
+    virtual void uart_listen(const bool on) = 0;
+    virtual int16_t uart_read() = 0; // -1 if no byte is waiting
+
+    uint32_t drv_status = 0; // Last DRV_STATUS read in the background
+};
+
+class TMCUartQueue {
+  public:
+    // Post a register read or write. Return false if the queue is full.
+    static bool read(TMCUartLink &link, const uint8_t reg, const tmc_uart_cb_t cb);
+    static bool write(TMCUartLink &link, const uint8_t reg, const uint32_t value, const tmc_uart_cb_t cb=nullptr);
+
+    // Send requests and collect replies that have arrived
+    static void service();
+
+    // Complete all posted transactions. Call before accessing drivers directly.
+    static void sync();
+
+    static bool idle() { return !count; }
+
+  private:
+    typedef struct {
+      TMCUartLink *link;
+      tmc_uart_cb_t cb;
+      uint32_t value;
+      uint8_t reg;
+      bool write;
+    } transaction_t;
+
+    static transaction_t queue[TMC_UART_QUEUE_SIZE];
+    static uint8_t head, count, retries, received;
+    static uint8_t reply[8];
+    static bool waiting;
+    static millis_t timeout_ms;
+
+    static bool post(TMCUartLink &link, const uint8_t reg, const uint32_t value, const bool write, const tmc_uart_cb_t cb);
+    static void start(const transaction_t &t);
+    static void finish(const bool ok, const uint32_t value);
+    static uint8_t crc8(const uint8_t * const data, const uint8_t len);
+};
+
+extern TMCUartQueue tmc_uart;
@@ -32,6 +32,11 @@
 #include "../libs/duration_t.h"
 #include "../gcode/gcode.h"
 
+#if ENABLED(TMC_HYBRID_TUNING)
+  #include "../module/motion.h"
+  #include "../module/stepper.h"
+#endif
+
 #if ENABLED(TMC_DEBUG)
   #include "../libs/hex_print.h"
   #if ENABLED(MONITOR_DRIVER_STATUS)
@@ -140,11 +145,11 @@
       static uint32_t get_pwm_scale(TMC2208Stepper &st) { return st.pwm_scale_sum(); }
     #endif
 
-    static TMC_driver_data get_driver_data(TMC2208Stepper &st) {
+    static TMC_driver_data get_driver_data(TMC2208Stepper&, const uint32_t ds) {
       constexpr uint8_t OTPW_bp = 0, OT_bp = 1;
       constexpr uint8_t S2G_bm = 0b111100; // 2..5
       TMC_driver_data data;
-      const auto ds = data.drv_status = st.DRV_STATUS();
+      data.drv_status = ds;
       data.is_otpw = TEST(ds, OTPW_bp);
       data.is_ot = TEST(ds, OT_bp);
       data.is_s2g = !!(ds & S2G_bm);
@@ -169,8 +174,107 @@
       return data;
     }
 
+    static TMC_driver_data get_driver_data(TMC2208Stepper &st) { return get_driver_data(st, st.DRV_STATUS()); }
+
   #endif // TMC2208 || TMC2209
 
+  #if ENABLED(TMC_UART_ASYNC)
+
+    /**
+     * UART drivers are polled in the background by tmc_uart. Each poll
+     * cycle evaluates the DRV_STATUS values received since the last one.
+     */
+    constexpr uint8_t TMC220x_DRV_STATUS = 0x6F;
+
+    static void store_drv_status(TMCUartLink &link, const uint8_t, const uint32_t value, const bool ok) {
+      link.drv_status = ok ? value : 0;
+    }
+
+    template<typename TMC>
+    static TMC_driver_data polled_driver_data(TMC &st) { return get_driver_data(st); }
+    template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
+    static TMC_driver_data polled_driver_data(TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> &st) {
+      return get_driver_data(st, st.drv_status);
+    }
+    template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
+    static TMC_driver_data polled_driver_data(TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> &st) {
+      return get_driver_data(st, st.drv_status);
+    }
+
+    // Post DRV_STATUS reads for all UART drivers in one batch
+    static void poll_uart_drivers() {
+      #define _POLL_DRV_STATUS(ST) (void)tmc_uart.read(stepper##ST, TMC220x_DRV_STATUS, store_drv_status)
+      #if AXIS_HAS_UART(X)
+        _POLL_DRV_STATUS(X);
+      #endif
+      #if AXIS_HAS_UART(X2)
+        _POLL_DRV_STATUS(X2);
+      #endif
+      #if AXIS_HAS_UART(Y)
+        _POLL_DRV_STATUS(Y);
+      #endif
+      #if AXIS_HAS_UART(Y2)
+        _POLL_DRV_STATUS(Y2);
+      #endif
+      #if AXIS_HAS_UART(Z)
+        _POLL_DRV_STATUS(Z);
+      #endif
+      #if AXIS_HAS_UART(Z2)
+        _POLL_DRV_STATUS(Z2);
+      #endif
+      #if AXIS_HAS_UART(Z3)
+        _POLL_DRV_STATUS(Z3);
+      #endif
+      #if AXIS_HAS_UART(Z4)
+        _POLL_DRV_STATUS(Z4);
+      #endif
+      #if AXIS_HAS_UART(I)
+        _POLL_DRV_STATUS(I);
+      #endif
+      #if AXIS_HAS_UART(J)
+        _POLL_DRV_STATUS(J);
+      #endif
+      #if AXIS_HAS_UART(K)
+        _POLL_DRV_STATUS(K);
+      #endif
+      #if AXIS_HAS_UART(U)
+        _POLL_DRV_STATUS(U);
+      #endif
+      #if AXIS_HAS_UART(V)
+        _POLL_DRV_STATUS(V);
+      #endif
+      #if AXIS_HAS_UART(W)
+        _POLL_DRV_STATUS(W);
+      #endif
+      #if AXIS_HAS_UART(E0)
+        _POLL_DRV_STATUS(E0);
+      #endif
+      #if AXIS_HAS_UART(E1)
+        _POLL_DRV_STATUS(E1);
+      #endif
+      #if AXIS_HAS_UART(E2)
+        _POLL_DRV_STATUS(E2);
+      #endif
+      #if AXIS_HAS_UART(E3)
+        _POLL_DRV_STATUS(E3);
+      #endif
+      #if AXIS_HAS_UART(E4)
+        _POLL_DRV_STATUS(E4);
+      #endif
+      #if AXIS_HAS_UART(E5)
+        _POLL_DRV_STATUS(E5);
+      #endif
+      #if AXIS_HAS_UART(E6)
+        _POLL_DRV_STATUS(E6);
+      #endif
+      #if AXIS_HAS_UART(E7)
+        _POLL_DRV_STATUS(E7);
+      #endif
+      #undef _POLL_DRV_STATUS
+    }
+
+  #endif // TMC_UART_ASYNC
+
   #if HAS_DRIVER(TMC2660)
 
     #if ENABLED(TMC_DEBUG)
@@ -280,7 +384,7 @@
 
   template<typename TMC>
   bool monitor_tmc_driver(TMC &st, const bool need_update_error_counters, const bool need_debug_reporting) {
-    TMC_driver_data data = get_driver_data(st);
+    TMC_driver_data data = TERN(TMC_UART_ASYNC, polled_driver_data(st), get_driver_data(st));
     if (data.drv_status == 0xFFFFFFFF || data.drv_status == 0x0) return false;
 
     bool should_step_down = false;
@@ -463,11 +567,289 @@
       #endif
 
       if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
+
+      TERN_(TMC_UART_ASYNC, poll_uart_drivers());
     }
+
+    TERN_(TMC_UART_ASYNC, tmc_uart.service());
   }
 
 #endif // MONITOR_DRIVER_STATUS
 
+#if ENABLED(TMC_HYBRID_TUNING)
+
+  /**
+   * Hybrid threshold and chopper tuning for TMC2208/TMC2209 axes
+   *
+   * StealthChop raises the PWM amplitude with speed until it runs out of
+   * supply voltage. Near that point PWM_SCALE_SUM saturates, the load seen
+   * by StallGuard rises (SG_RESULT drops) and the coil current can't follow
+   * (open load flags). The axis is swept up in speed in StealthChop and the
+   * hybrid threshold set a margin below the first speed showing any of these.
+   * The chopper preset that best holds current in SpreadCycle above the
+   * threshold is kept.
+   */
+
+  typedef struct {
+    uint8_t pwm_scale_max;  // Highest PWM_SCALE_SUM
+    uint16_t sg_min;        // Lowest SG_RESULT (TMC2209 only)
+    uint8_t cs_max;         // Highest CS_ACTUAL
+    uint16_t open_load;     // Samples flagging OLA/OLB
+  } tmc_tuning_result_t;
+
+  enum TMCTuningMode : uint8_t { TUNE_STEALTH, TUNE_SPREAD, TUNE_APPLY, TUNE_RESTORE };
+
+  static uint16_t tuning_sg_result(TMC2208Stepper&)    { return UINT16_MAX; }
+  #if HAS_DRIVER(TMC2209)
+    static uint16_t tuning_sg_result(TMC2209Stepper &st) { return st.SG_RESULT(); }
+  #endif
+
+  template<typename TMC>
+  static void tuning_sample(TMC &st, tmc_tuning_result_t &r) {
+    constexpr uint8_t OLA_bp = 6, OLB_bp = 7, CS_ACTUAL_sb = 16;
+    constexpr uint32_t CS_ACTUAL_bm = 0x1F0000; // 16:20
+    const uint32_t ds = st.DRV_STATUS();
+    if (ds == 0xFFFFFFFF || ds == 0) return;
+    NOLESS(r.cs_max, uint8_t((ds & CS_ACTUAL_bm) >> CS_ACTUAL_sb));
+    if (TEST(ds, OLA_bp) || TEST(ds, OLB_bp)) r.open_load++;
+    NOLESS(r.pwm_scale_max, uint8_t(st.pwm_scale_sum()));
+    NOMORE(r.sg_min, tuning_sg_result(st));
+  }
+
+  template<typename TMC>
+  static void tuning_mode(TMC &st, const TMCTuningMode mode, const uint32_t thrs, const chopper_timing_t &ct) {
+    switch (mode) {
+      case TUNE_STEALTH: st.TPWMTHRS(0); st.en_spreadCycle(false); break; // StealthChop at any speed
+      case TUNE_SPREAD: st.set_chopper_times(ct); st.en_spreadCycle(true); break;
+      case TUNE_APPLY: st.set_chopper_times(ct); st.set_pwm_thrs(thrs); st.refresh_stepping_mode(); break;
+      case TUNE_RESTORE: st.set_chopper_times(ct); st.TPWMTHRS(thrs); st.refresh_stepping_mode(); break; // Raw TPWMTHRS
+    }
+  }
+
+  // Set the mode of all drivers on an axis and sample the first one
+  static void tuning_axis(const AxisEnum axis, const TMCTuningMode mode, const uint32_t thrs=0, const chopper_timing_t &ct=chopper_timing_t{ 0, 0, 0 }) {
+    #define _TUNE_MODE(ST) tuning_mode(stepper##ST, mode, thrs, ct)
+    switch (axis) {
+      #if AXIS_HAS_UART(X)
+        case X_AXIS:
+          _TUNE_MODE(X);
+          #if AXIS_HAS_UART(X2)
+            _TUNE_MODE(X2);
+          #endif
+          break;
+      #endif
+      #if AXIS_HAS_UART(Y)
+        case Y_AXIS:
+          _TUNE_MODE(Y);
+          #if AXIS_HAS_UART(Y2)
+            _TUNE_MODE(Y2);
+          #endif
+          break;
+      #endif
+      #if AXIS_HAS_UART(Z)
+        case Z_AXIS:
+          _TUNE_MODE(Z);
+          #if AXIS_HAS_UART(Z2)
+            _TUNE_MODE(Z2);
+          #endif
+          #if AXIS_HAS_UART(Z3)
+            _TUNE_MODE(Z3);
+          #endif
+          #if AXIS_HAS_UART(Z4)
+            _TUNE_MODE(Z4);
+          #endif
+          break;
+      #endif
+      default: break;
+    }
+    #undef _TUNE_MODE
+  }
+
+  static void tuning_sample(const AxisEnum axis, tmc_tuning_result_t &r) {
+    switch (axis) {
+      #if AXIS_HAS_UART(X)
+        case X_AXIS: tuning_sample(stepperX, r); break;
+      #endif
+      #if AXIS_HAS_UART(Y)
+        case Y_AXIS: tuning_sample(stepperY, r); break;
+      #endif
+      #if AXIS_HAS_UART(Z)
+        case Z_AXIS: tuning_sample(stepperZ, r); break;
+      #endif
+      default: break;
+    }
+  }
+
+  // The raw TPWMTHRS of an axis, to restore after an aborted tuning
+  static uint32_t tuning_get_tpwmthrs(const AxisEnum axis) {
+    switch (axis) {
+      #if AXIS_HAS_UART(X)
+        case X_AXIS: return stepperX.TPWMTHRS();
+      #endif
+      #if AXIS_HAS_UART(Y)
+        case Y_AXIS: return stepperY.TPWMTHRS();
+      #endif
+      #if AXIS_HAS_UART(Z)
+        case Z_AXIS: return stepperZ.TPWMTHRS();
+      #endif
+      default: return 0;
+    }
+  }
+
+  chopper_timing_t tmc_get_chopper_times(const AxisEnum axis) {
+    #define _GET_CHOPPER(ST) \
+      return chopper_timing_t{ uint8_t(stepper##ST.toff()), int8_t(stepper##ST.hysteresis_end()), uint8_t(stepper##ST.hysteresis_start()) }
+    switch (axis) {
+      #if AXIS_HAS_UART(X)
+        case X_AXIS: _GET_CHOPPER(X);
+      #endif
+      #if AXIS_HAS_UART(Y)
+        case Y_AXIS: _GET_CHOPPER(Y);
+      #endif
+      #if AXIS_HAS_UART(Z)
+        case Z_AXIS: _GET_CHOPPER(Z);
+      #endif
+      default: return chopper_timing_t{ 0, 0, 0 };
+    }
+    #undef _GET_CHOPPER
+  }
+
+  void tmc_set_chopper_times(const AxisEnum axis, const chopper_timing_t &ct) {
+    if (ct.toff == 0) return; // Not tuned
+    #define _SET_CHOPPER(ST) stepper##ST.set_chopper_times(ct)
+    switch (axis) {
+      #if AXIS_HAS_UART(X)
+        case X_AXIS:
+          _SET_CHOPPER(X);
+          #if AXIS_HAS_UART(X2)
+            _SET_CHOPPER(X2);
+          #endif
+          break;
+      #endif
+      #if AXIS_HAS_UART(Y)
+        case Y_AXIS:
+          _SET_CHOPPER(Y);
+          #if AXIS_HAS_UART(Y2)
+            _SET_CHOPPER(Y2);
+          #endif
+          break;
+      #endif
+      #if AXIS_HAS_UART(Z)
+        case Z_AXIS:
+          _SET_CHOPPER(Z);
+          #if AXIS_HAS_UART(Z2)
+            _SET_CHOPPER(Z2);
+          #endif
+          #if AXIS_HAS_UART(Z3)
+            _SET_CHOPPER(Z3);
+          #endif
+          #if AXIS_HAS_UART(Z4)
+            _SET_CHOPPER(Z4);
+          #endif
+          break;
+      #endif
+      default: break;
+    }
+    #undef _SET_CHOPPER
+  }
+
+  // Move back and forth across the middle of the axis, sampling the driver
+  static tmc_tuning_result_t tuning_run(const AxisEnum axis, const feedRate_t fr_mm_s) {
+    tmc_tuning_result_t r = { 0, UINT16_MAX, 0, 0 };
+    const float mid = (soft_endstop.min[axis] + soft_endstop.max[axis]) * 0.5f,
+                half = _MIN(float(TMC_TUNING_DISTANCE), soft_endstop.max[axis] - soft_endstop.min[axis]) * 0.5f;
+    LOOP_L_N(pass, 2) {
+      current_position[axis] = mid + (pass ? -half : half);
+      line_to_current_position(fr_mm_s);
+      while (planner.has_blocks_queued()) {
+        idle();
+        if (stepper.axis_is_moving(axis)) tuning_sample(axis, r);
+      }
+    }
+    return r;
+  }
+
+  static bool tuning_ok(const tmc_tuning_result_t &r) {
+    return r.pwm_scale_max < TMC_TUNING_PWM_LIMIT && r.sg_min > TMC_TUNING_SG_LIMIT && !r.open_load;
+  }
+
+  /**
+   * Find the hybrid threshold and chopper timing for an axis.
+   * The sweep may lose steps, so the axis must be homed again afterward.
+   */
+  TMCTuningResult tmc_tune_axis(const AxisEnum axis) {
+    switch (axis) {
+      #if AXIS_HAS_UART(X)
+        case X_AXIS:
+      #endif
+      #if AXIS_HAS_UART(Y)
+        case Y_AXIS:
+      #endif
+      #if AXIS_HAS_UART(Z)
+        case Z_AXIS:
+      #endif
+        break;
+      default: return TMC_TUNE_NO_DRIVER;
+    }
+
+    const feedRate_t fr_max = planner.settings.max_feedrate_mm_s[axis],
+                     fr_step = fr_max / (TMC_TUNING_STEPS);
+
+    // Center the axis at a moderate speed before sweeping
+    current_position[axis] = (soft_endstop.min[axis] + soft_endstop.max[axis]) * 0.5f;
+    line_to_current_position(fr_step);
+    planner.synchronize();
+
+    // Speed up in StealthChop until the driver shows strain
+    const chopper_timing_t old_ct = tmc_get_chopper_times(axis);
+    const uint32_t old_tpwmthrs = tuning_get_tpwmthrs(axis);
+    tuning_axis(axis, TUNE_STEALTH);
+    feedRate_t fr_good = 0, fr = fr_step;
+    for (; fr <= fr_max + 0.01f; fr += fr_step) {
+      const tmc_tuning_result_t r = tuning_run(axis, fr);
+      SERIAL_CHAR(AXIS_CHAR(axis));
+      SERIAL_ECHOPGM(" ", int(fr), "mm/s pwm:", r.pwm_scale_max, " cs:", r.cs_max);
+      if (r.sg_min != UINT16_MAX) SERIAL_ECHOPGM(" sg:", r.sg_min);
+      if (r.open_load) SERIAL_ECHOPGM(" ol:", r.open_load);
+      SERIAL_EOL();
+      if (!tuning_ok(r)) break;
+      fr_good = fr;
+    }
+
+    // Even the slowest speed strained the driver. Keep the old settings.
+    if (!fr_good) {
+      tuning_axis(axis, TUNE_RESTORE, old_tpwmthrs, old_ct);
+      set_axis_never_homed(axis);
+      SERIAL_CHAR(AXIS_CHAR(axis));
+      SERIAL_ECHOLNPGM(" failed at ", int(fr_step), "mm/s. Settings unchanged.");
+      return TMC_TUNE_FAILED;
+    }
+
+    const uint32_t thrs = _MAX(1, int(fr_good * (TMC_TUNING_MARGIN)));
+
+    // Try the chopper presets in SpreadCycle just above the threshold
+    static const chopper_timing_t choppers[] PROGMEM = TMC_TUNING_CHOPPERS;
+    chopper_timing_t best = old_ct;
+    uint16_t best_ol = UINT16_MAX;
+    const feedRate_t fr_spread = _MIN(fr_max, _MAX(fr, thrs * 1.2f));
+    LOOP_L_N(i, COUNT(choppers) + 1) {
+      chopper_timing_t ct = best;
+      if (i) memcpy_P(&ct, &choppers[i - 1], sizeof(ct));
+      tuning_axis(axis, TUNE_SPREAD, 0, ct);
+      const tmc_tuning_result_t r = tuning_run(axis, fr_spread);
+      if (r.open_load < best_ol) { best_ol = r.open_load; best = ct; }
+    }
+
+    tuning_axis(axis, TUNE_APPLY, thrs, best);
+    set_axis_never_homed(axis);
+
+    SERIAL_CHAR(AXIS_CHAR(axis));
+    SERIAL_ECHOLNPGM(" hybrid threshold:", thrs, "mm/s chopper toff:", best.toff, " hend:", best.hend, " hstrt:", best.hstrt);
+    return TMC_TUNE_OK;
+  }
+
+#endif // TMC_HYBRID_TUNING
+
 #if ENABLED(TMC_DEBUG)
 
   /**
@@ -29,6 +29,10 @@
 #include <TMCStepper.h>   // TMCstepper - https://github.com/teemuatlut/TMCStepper
 #include "../module/planner.h"
 
+#if ENABLED(TMC_UART_ASYNC)
+  #include "tmc_uart.h"
+#endif
+
 #define CHOPPER_DEFAULT_12V  { 3, -1, 1 }
 #define CHOPPER_DEFAULT_19V  { 4,  1, 1 }
 #define CHOPPER_DEFAULT_24V  { 4,  2, 1 }
@@ -160,7 +164,11 @@ class TMCMarlin : public TMC, public TMCStorage<AXIS_LETTER, DRIVER_ID> {
 };
 
 template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
-class TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC2208Stepper, public TMCStorage<AXIS_LETTER, DRIVER_ID> {
+class TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC2208Stepper, public TMCStorage<AXIS_LETTER, DRIVER_ID>
+  #if ENABLED(TMC_UART_ASYNC)
+    , public TMCUartLink
+  #endif
+{
   public:
     TMCMarlin(Stream * SerialPort, const float RS, const uint8_t) :
       TMC2208Stepper(SerialPort, RS)
@@ -183,6 +191,21 @@ class TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
     }
     uint16_t get_microstep_counter() { return TMC2208Stepper::MSCNT(); }
 
+    #if ENABLED(TMC_UART_ASYNC)
+      uint8_t uart_address() override { return this->slave_address; }
+      void uart_send(const uint8_t * const data, const uint8_t len) override {
+        this->preWriteCommunication();
+        LOOP_L_N(i, len) this->serial_write(data[i]);
+        this->postWriteCommunication();
+      }
+      void uart_listen(const bool on) override { if (on) this->preReadCommunication(); else this->postReadCommunication(); }
+      int16_t uart_read() override { return this->available() > 0 ? this->serial_read() : -1; }
+
+      // Every direct register access finishes the background transactions first
+      void write(uint8_t reg, uint32_t data) override { tmc_uart.sync(); TMC2208Stepper::write(reg, data); }
+      uint32_t read(uint8_t reg) override { tmc_uart.sync(); return TMC2208Stepper::read(reg); }
+    #endif
+
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return !this->en_spreadCycle(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
@@ -217,7 +240,11 @@ class TMCMarlin<TMC2208Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
 };
 
 template<char AXIS_LETTER, char DRIVER_ID, AxisEnum AXIS_ID>
-class TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC2209Stepper, public TMCStorage<AXIS_LETTER, DRIVER_ID> {
+class TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC2209Stepper, public TMCStorage<AXIS_LETTER, DRIVER_ID>
+  #if ENABLED(TMC_UART_ASYNC)
+    , public TMCUartLink
+  #endif
+{
   public:
     TMCMarlin(Stream * SerialPort, const float RS, const uint8_t addr) :
       TMC2209Stepper(SerialPort, RS, addr)
@@ -237,6 +264,21 @@ class TMCMarlin<TMC2209Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC220
     }
     uint16_t get_microstep_counter() { return TMC2209Stepper::MSCNT(); }
 
+    #if ENABLED(TMC_UART_ASYNC)
+      uint8_t uart_address() override { return this->slave_address; }
+      void uart_send(const uint8_t * const data, const uint8_t len) override {
+        this->preWriteCommunication();
+        LOOP_L_N(i, len) this->serial_write(data[i]);
+        this->postWriteCommunication();
+      }
+      void uart_listen(const bool on) override { if (on) this->preReadCommunication(); else this->postReadCommunication(); }
+      int16_t uart_read() override { return this->available() > 0 ? this->serial_read() : -1; }
+
+      // Every direct register access finishes the background transactions first
+      void write(uint8_t reg, uint32_t data) override { tmc_uart.sync(); TMC2209Stepper::write(reg, data); }
+      uint32_t read(uint8_t reg) override { tmc_uart.sync(); return TMC2209Stepper::read(reg); }
+    #endif
+
     #if HAS_STEALTHCHOP
       bool get_stealthChop()                { return !this->en_spreadCycle(); }
       bool get_stored_stealthChop()         { return this->stored.stealthChop_enabled; }
@@ -328,6 +370,13 @@ class TMCMarlin<TMC2660Stepper, AXIS_LETTER, DRIVER_ID, AXIS_ID> : public TMC266
 };
 
 void monitor_tmc_drivers();
+
+#if ENABLED(TMC_HYBRID_TUNING)
+  enum TMCTuningResult : uint8_t { TMC_TUNE_NO_DRIVER, TMC_TUNE_FAILED, TMC_TUNE_OK };
+  TMCTuningResult tmc_tune_axis(const AxisEnum axis);
+  chopper_timing_t tmc_get_chopper_times(const AxisEnum axis);
+  void tmc_set_chopper_times(const AxisEnum axis, const chopper_timing_t &ct);
+#endif
 void test_tmc_connection(LOGICAL_AXIS_DECL(const bool, true));
 
 #if ENABLED(TMC_DEBUG)
@@ -93,6 +93,10 @@
  *   X #  X Coord.    Specify the starting location of the drawing activity.
  *
  *   Y #  Y Coord.    Specify the starting location of the drawing activity.
+ *
+ *   With G26_STREAM_PATTERN the pattern is fed to the planner as one continuous stream. There is no
+ *   wait for each circle to finish, and the retract and recover are folded into the Z lift and drop
+ *   of each travel move, so the planner buffer stays full and the print runs at the set feedrate.
  */
 
 #include "../../inc/MarlinConfig.h"
@@ -228,12 +232,35 @@ typedef struct {
     }
   }
 
-  // TODO: Parameterize the Z lift with a define
-  void retract_lift_move(const xyz_pos_t &s) {
-    retract_filament(destination);
-    move_to(current_position.x, current_position.y, current_position.z + 0.5f, 0.0f);  // Z lift to minimize scraping
-    move_to(s.x, s.y, s.z + 0.5f, 0.0f);  // Get to the starting point with no extrusion while lifted
-  }
+  #if ENABLED(G26_STREAM_PATTERN)
+
+    // A single move with both Z and E, so the retract or recover costs no extra stop
+    void z_move_with_e(const_float_t z, const_float_t e_delta) {
+      destination = current_position;
+      destination.z = z;
+      destination.e += e_delta;
+      prepare_internal_move_to_destination(planner.settings.max_feedrate_mm_s[Z_AXIS] * 0.5f);
+    }
+
+    // Retract while lifting, travel, then recover while dropping to the layer at the starting point
+    void retract_lift_move(const xyz_pos_t &s) {
+      z_move_with_e(current_position.z + 0.5f, g26_retracted ? 0.0f : -1.0f * retraction_multiplier);
+      g26_retracted = true;
+      move_to(s.x, s.y, current_position.z, 0.0f);  // Get to the starting point with no extrusion while lifted
+      z_move_with_e(layer_height, 1.2f * retraction_multiplier);
+      g26_retracted = false;
+    }
+
+  #else
+
+    // TODO: Parameterize the Z lift with a define
+    void retract_lift_move(const xyz_pos_t &s) {
+      retract_filament(destination);
+      move_to(current_position.x, current_position.y, current_position.z + 0.5f, 0.0f);  // Z lift to minimize scraping
+      move_to(s.x, s.y, s.z + 0.5f, 0.0f);  // Get to the starting point with no extrusion while lifted
+    }
+
+  #endif
 
   void recover_filament(const xyz_pos_t &where) {
     if (g26_retracted) { // Only un-retract if we are retracted.
@@ -835,7 +862,8 @@ void GcodeSuite::G26() {
       g26.connect_neighbor_with_line(location.pos,  1,  0);
       g26.connect_neighbor_with_line(location.pos,  0, -1);
       g26.connect_neighbor_with_line(location.pos,  0,  1);
-      planner.synchronize();
+      // Streamed, the circle is reported done when planned, a few moves ahead of the nozzle
+      IF_DISABLED(G26_STREAM_PATTERN, planner.synchronize());
       TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location.pos, ExtUI::G26_POINT_FINISH));
       if (TERN0(HAS_MARLINUI_MENU, user_canceled())) goto LEAVE;
     }
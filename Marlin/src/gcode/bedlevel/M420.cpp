@@ -51,6 +51,11 @@
  *   L[index]  Load UBL mesh from index (0 is default)
  *   T[map]    0:Human-readable 1:CSV 2:"LCD" 4:Compact
  *
+ * With BILINEAR_MESH_SLOTS only:
+ *
+ *   W[index]  Save the mesh to index, tagged with the bed target temperature
+ *   L[index]  Load the mesh from index
+ *
  * With mesh-based leveling only:
  *
  *   C         Center mesh on the mean of the lowest and highest
@@ -136,6 +141,47 @@ void GcodeSuite::M420() {
 
   #endif // AUTO_BED_LEVELING_UBL
 
+  #if ENABLED(BILINEAR_MESH_SLOTS)
+
+    if (parser.seen("WL")) {
+      const int16_t a = settings.calc_num_meshes();
+      if (!a) {
+        SERIAL_ECHOLNPGM("?EEPROM storage not available.");
+        return;
+      }
+
+      // W to save the mesh to the EEPROM
+      if (parser.seen('W')) {
+        const int8_t storage_slot = parser.has_value() ? parser.value_int() : bedlevel.storage_slot;
+        if (!WITHIN(storage_slot, 0, a - 1)) {
+          SERIAL_ECHOLNPGM("?Invalid storage slot.");
+          SERIAL_ECHOLNPGM("?Use 0 to ", a - 1);
+          return;
+        }
+        if (!leveling_is_valid()) {
+          SERIAL_ECHO_MSG("Invalid mesh.");
+          return;
+        }
+        settings.store_mesh(storage_slot);
+      }
+
+      // L to load a mesh from the EEPROM
+      if (parser.seen('L')) {
+        const int8_t storage_slot = parser.has_value() ? parser.value_int() : bedlevel.storage_slot;
+        if (!WITHIN(storage_slot, 0, a - 1)) {
+          SERIAL_ECHOLNPGM("?Invalid storage slot.");
+          SERIAL_ECHOLNPGM("?Use 0 to ", a - 1);
+          return;
+        }
+        set_bed_leveling_enabled(false);
+        settings.load_mesh(storage_slot);
+      }
+
+      SERIAL_ECHOLNPGM("Storage slot: ", bedlevel.storage_slot);
+    }
+
+  #endif // BILINEAR_MESH_SLOTS
+
   const bool seenV = parser.seen_test('V');
 
   #if HAS_MESH
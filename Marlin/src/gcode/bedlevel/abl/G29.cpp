@@ -43,6 +43,18 @@
   #include "../../../libs/vector_3.h"
 #endif
 
+#if EITHER(ABL_HILBERT_CURVE, ABL_SHORTEST_PROBE_PATH)
+  #include "../../../feature/bedlevel/abl/probe_order.h"
+#endif
+
+#if ENABLED(THERMAL_Z_MODEL)
+  #include "../../../feature/thermal_z_model.h"
+#endif
+
+#if ENABLED(BABYSTEP_MESH_FEEDBACK)
+  #include "../../../feature/babystep.h"
+#endif
+
 #include "../../../lcd/marlinui.h"
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../../lcd/extui/ui_api.h"
@@ -57,6 +69,10 @@
   #include "../../../module/printcounter.h"
 #endif
 
+#if BOTH(ABL_ADAPTIVE_MESH, SDSUPPORT)
+  #include "../../../sd/cardreader.h"
+#endif
+
 #if HAS_MULTI_HOTEND
   #include "../../../module/tool_change.h"
 #endif
@@ -139,6 +155,11 @@ public:
       bed_mesh_t z_values;
     #endif
 
+    #if ENABLED(ABL_ADAPTIVE_MESH)
+      bool adaptive;                        // Probe only the points around the print area
+      xy_int8_t adaptive_min, adaptive_max; // Range of grid points to probe
+    #endif
+
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
       int indexIntoAB[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
       float eqnAMatrix[(GRID_MAX_POINTS) * 3], // "A" matrix of the linear system of equations
@@ -206,6 +227,16 @@ public:
  *
  *  Z  Supply an additional Z probe offset
  *
+ * Parameters with ABL_ADAPTIVE_MESH only:
+ *
+ *  A  Adaptive: Re-probe the part of the stored mesh under the print area.
+ *     With A the L, R, F, B limits give the print area. Without them the print
+ *     area comes from the SD file header. Only the stored grid points around the
+ *     print area are probed again; the rest of the mesh is kept. The stored mesh
+ *     must have the same grid, and no denser grid is added locally.
+ *     A2 Replace the stored mesh with a grid laid over the print area instead,
+ *     if there is no stored mesh with the same grid.
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -403,6 +434,40 @@ G29_TYPE GcodeSuite::G29() {
       const float x_min = probe.min_x(), x_max = probe.max_x(),
                   y_min = probe.min_y(), y_max = probe.max_y();
 
+      #if ENABLED(ABL_ADAPTIVE_MESH)
+
+        // A = Adaptive, with the print area from L R F B or the file header
+        abl.adaptive = parser.seen_test('A');
+        xy_pos_t area_lf { x_min, y_min }, area_rb { x_max, y_max };
+        if (abl.adaptive) {
+          if (parser.seen("LRFB")) {
+            area_lf.set(parser.linearval('L', x_min), parser.linearval('F', y_min));
+            area_rb.set(parser.linearval('R', x_max), parser.linearval('B', y_max));
+          }
+          #if ENABLED(SDSUPPORT)
+            else if (card.has_print_area()) {
+              area_lf = card.print_area_min;
+              area_rb = card.print_area_max;
+            }
+          #endif
+          else {
+            SERIAL_ECHOLNPGM("?(A)daptive needs L,R,F,B or a print area in the file header.");
+            G29_RETURN(false, false);
+          }
+          area_lf.set(_MAX(area_lf.x - (ADAPTIVE_MESH_MARGIN), x_min), _MAX(area_lf.y - (ADAPTIVE_MESH_MARGIN), y_min));
+          area_rb.set(_MIN(area_rb.x + (ADAPTIVE_MESH_MARGIN), x_max), _MIN(area_rb.y + (ADAPTIVE_MESH_MARGIN), y_max));
+          if (area_rb.x <= area_lf.x || area_rb.y <= area_lf.y) {
+            SERIAL_ECHOLNPGM("? Print area out of bounds.");
+            G29_RETURN(false, false);
+          }
+          // The grid is laid over the whole bed, just like a plain G29
+          abl.probe_position_lf.set(x_min, y_min);
+          abl.probe_position_rb.set(x_max, y_max);
+        }
+        else
+
+      #endif
+
       if (parser.seen('H')) {
         const int16_t size = (int16_t)parser.value_linear_units();
         abl.probe_position_lf.set(_MAX((X_CENTER) - size / 2, x_min), _MAX((Y_CENTER) - size / 2, y_min));
@@ -426,6 +491,57 @@ G29_TYPE GcodeSuite::G29() {
       abl.gridSpacing.set((abl.probe_position_rb.x - abl.probe_position_lf.x) / (abl.grid_points.x - 1),
                           (abl.probe_position_rb.y - abl.probe_position_lf.y) / (abl.grid_points.y - 1));
 
+      #if ENABLED(ABL_ADAPTIVE_MESH)
+        if (abl.adaptive) {
+          // The stored grid matches if it was probed with the same limits. Allow for
+          // float rounding, since the stored values may come from EEPROM or M420.
+          const xy_pos_t dspace = abl.gridSpacing - bedlevel.grid_spacing,
+                         dstart = abl.probe_position_lf - bedlevel.grid_start;
+          const bool same_grid = leveling_is_valid()
+                              && ABS(dspace.x) < 0.01f && ABS(dspace.y) < 0.01f
+                              && ABS(dstart.x) < 0.01f && ABS(dstart.y) < 0.01f;
+          if (same_grid) {
+            // Keep the stored grid exactly so its other points are preserved
+            abl.gridSpacing = bedlevel.grid_spacing;
+            abl.probe_position_lf = bedlevel.grid_start;
+            abl.probe_position_rb.set(abl.probe_position_lf.x + abl.gridSpacing.x * (abl.grid_points.x - 1),
+                                      abl.probe_position_lf.y + abl.gridSpacing.y * (abl.grid_points.y - 1));
+            // Re-probe only the grid points around the print area
+            abl.adaptive_min.set(FLOOR((area_lf.x - abl.probe_position_lf.x) / abl.gridSpacing.x),
+                                 FLOOR((area_lf.y - abl.probe_position_lf.y) / abl.gridSpacing.y));
+            abl.adaptive_max.set(CEIL((area_rb.x - abl.probe_position_lf.x) / abl.gridSpacing.x),
+                                 CEIL((area_rb.y - abl.probe_position_lf.y) / abl.gridSpacing.y));
+            LIMIT(abl.adaptive_min.x, 0, abl.grid_points.x - 1);
+            LIMIT(abl.adaptive_min.y, 0, abl.grid_points.y - 1);
+            LIMIT(abl.adaptive_max.x, 0, abl.grid_points.x - 1);
+            LIMIT(abl.adaptive_max.y, 0, abl.grid_points.y - 1);
+          }
+          else if (parser.intval('A') == 2) {
+            // A2: Replace the stored mesh with one laid over the print area,
+            // grown (within the probe limits) to keep a sensible minimum spacing.
+            const xy_float_t min_size = { float(ADAPTIVE_MESH_MIN_SPACING) * (abl.grid_points.x - 1),
+                                          float(ADAPTIVE_MESH_MIN_SPACING) * (abl.grid_points.y - 1) };
+            const xy_pos_t mid = (area_lf + area_rb) * 0.5f;
+            abl.probe_position_lf.set(_MAX(_MIN(area_lf.x, mid.x - min_size.x * 0.5f), x_min), _MAX(_MIN(area_lf.y, mid.y - min_size.y * 0.5f), y_min));
+            abl.probe_position_rb.set(_MIN(_MAX(area_rb.x, abl.probe_position_lf.x + min_size.x), x_max), _MIN(_MAX(area_rb.y, abl.probe_position_lf.y + min_size.y), y_max));
+            abl.gridSpacing.set((abl.probe_position_rb.x - abl.probe_position_lf.x) / (abl.grid_points.x - 1),
+                                (abl.probe_position_rb.y - abl.probe_position_lf.y) / (abl.grid_points.y - 1));
+            abl.adaptive = false;
+          }
+          else {
+            // Never throw away the full-bed mesh unless asked to
+            SERIAL_ECHOLNPGM("?(A)daptive needs a stored mesh with the same grid. Run G29 first, or G29 A2 to replace it.");
+            G29_RETURN(false, false);
+          }
+          if (abl.verbose_level || DEBUGGING(LEVELING)) {
+            if (abl.adaptive)
+              SERIAL_ECHOLNPGM("Adaptive: Re-probing points X", abl.adaptive_min.x, ":", abl.adaptive_max.x, " Y", abl.adaptive_min.y, ":", abl.adaptive_max.y);
+            else
+              SERIAL_ECHOLNPGM("Adaptive: Replacing mesh with grid L", abl.probe_position_lf.x, " R", abl.probe_position_rb.x, " F", abl.probe_position_lf.y, " B", abl.probe_position_rb.y);
+          }
+        }
+      #endif
+
     #endif // ABL_USES_GRID
 
     if (abl.verbose_level > 0) {
@@ -521,6 +637,9 @@ G29_TYPE GcodeSuite::G29() {
       // Pre-populate local Z values from the stored mesh
       TERN_(IS_KINEMATIC, COPY(abl.z_values, bedlevel.z_values));
 
+      // Points away from the print area keep their stored values
+      TERN_(ABL_ADAPTIVE_MESH, if (abl.adaptive) COPY(abl.z_values, bedlevel.z_values));
+
     #endif // AUTO_BED_LEVELING_BILINEAR
 
   } // !g29_in_progress
@@ -676,77 +795,115 @@ G29_TYPE GcodeSuite::G29() {
 
     #if ABL_USES_GRID
 
-      #if GRID_MAX_POINTS == (4*4)    // Ends at Right and FRONT_BACK_PROBE_BED_POSITION
-        bool zig = 1;
-      #else
-        bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
-      #endif 
-      // Outer loop is X with PROBE_Y_FIRST enabled
-      // Outer loop is Y with PROBE_Y_FIRST disabled
-      for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
-
-        int8_t inStart, inStop, inInc;
-
-        if (zig) {                      // Zig away from origin
-          inStart = 0;                  // Left or front
-          inStop = PR_INNER_SIZE;       // Right or back
-          inInc = 1;                    // Zig right
-        }
-        else {                          // Zag towards origin
-          inStart = PR_INNER_SIZE - 1;  // Right or back
-          inStop = -1;                  // Left or front
-          inInc = -1;                   // Zag left
+      // Tell if a grid point is left unprobed
+      auto skip_grid_point = [&](const xy_int8_t &mc) -> bool {
+        // Avoid probing outside the round or hexagonal area
+        if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probe_position_lf + abl.gridSpacing * mc.asFloat()))) return true;
+
+        #if ENABLED(ABL_ADAPTIVE_MESH)
+          // Skip points away from the print area
+          if (abl.adaptive && !( WITHIN(mc.x, abl.adaptive_min.x, abl.adaptive_max.x)
+                              && WITHIN(mc.y, abl.adaptive_min.y, abl.adaptive_max.y) )) return true;
+        #endif
+
+        return false;
+      };
+
+      // Probe the grid point at abl.meshCount. Return false to stop probing.
+      auto probe_grid_point = [&](const uint8_t pt_index) -> bool {
+
+        abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
+
+        TERN_(AUTO_BED_LEVELING_LINEAR, abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y] = ++abl.abl_probe_index); // 0...
+
+        if (skip_grid_point(abl.meshCount)) return true;
+
+        if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
+        TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
+
+        abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+
+        if (isnan(abl.measured_z)) {
+          set_bed_leveling_enabled(abl.reenable);
+          return false;
         }
 
-        zig ^= true; // zag
+        #if ENABLED(AUTO_BED_LEVELING_LINEAR)
 
-        // An index to print current state
-        uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
+          abl.mean += abl.measured_z;
+          abl.eqnBVector[abl.abl_probe_index] = abl.measured_z;
+          abl.eqnAMatrix[abl.abl_probe_index + 0 * abl.abl_points] = abl.probePos.x;
+          abl.eqnAMatrix[abl.abl_probe_index + 1 * abl.abl_points] = abl.probePos.y;
+          abl.eqnAMatrix[abl.abl_probe_index + 2 * abl.abl_points] = 1;
 
-        // Inner loop is Y with PROBE_Y_FIRST enabled
-        // Inner loop is X with PROBE_Y_FIRST disabled
-        for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
+          incremental_LSF(&lsf_results, abl.probePos, abl.measured_z);
 
-          abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
+        #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
-          TERN_(AUTO_BED_LEVELING_LINEAR, abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y] = ++abl.abl_probe_index); // 0...
+          const float z = abl.measured_z + abl.Z_offset;
+          abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
 
-          // Avoid probing outside the round or hexagonal area
-          if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) continue;
+        #endif
 
-          if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
-          TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
+        abl.reenable = false; // Don't re-enable after modifying the mesh
+        idle_no_sleep();
+        return true;
+      };
 
-          abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+      #if EITHER(ABL_HILBERT_CURVE, ABL_SHORTEST_PROBE_PATH)
 
-          if (isnan(abl.measured_z)) {
-            set_bed_leveling_enabled(abl.reenable);
-            break; // Breaks out of both loops
-          }
+        // Probe in the order with the least travel from here.
+        // Only the points to be probed are ordered.
+        ProbeOrder::reset();
+        LOOP_L_N(x, abl.grid_points.x) LOOP_L_N(y, abl.grid_points.y) {
+          const xy_int8_t mc = { int8_t(x), int8_t(y) };
+          if (!skip_grid_point(mc)) ProbeOrder::add(x, y);
+        }
+        ProbeOrder::sort(xy_pos_t(current_position) + probe.offset_xy, abl.probe_position_lf, abl.gridSpacing);
 
-          #if ENABLED(AUTO_BED_LEVELING_LINEAR)
+        LOOP_L_N(i, ProbeOrder::count) {
+          abl.meshCount = ProbeOrder::point[i];
+          if (!probe_grid_point(i + 1)) break;
+        }
 
-            abl.mean += abl.measured_z;
-            abl.eqnBVector[abl.abl_probe_index] = abl.measured_z;
-            abl.eqnAMatrix[abl.abl_probe_index + 0 * abl.abl_points] = abl.probePos.x;
-            abl.eqnAMatrix[abl.abl_probe_index + 1 * abl.abl_points] = abl.probePos.y;
-            abl.eqnAMatrix[abl.abl_probe_index + 2 * abl.abl_points] = 1;
+      #else
 
-            incremental_LSF(&lsf_results, abl.probePos, abl.measured_z);
+        #if GRID_MAX_POINTS == (4*4)    // Ends at Right and FRONT_BACK_PROBE_BED_POSITION
+          bool zig = 1;
+        #else
+          bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
+        #endif
+        // Outer loop is X with PROBE_Y_FIRST enabled
+        // Outer loop is Y with PROBE_Y_FIRST disabled
+        for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
+
+          int8_t inStart, inStop, inInc;
+
+          if (zig) {                      // Zig away from origin
+            inStart = 0;                  // Left or front
+            inStop = PR_INNER_SIZE;       // Right or back
+            inInc = 1;                    // Zig right
+          }
+          else {                          // Zag towards origin
+            inStart = PR_INNER_SIZE - 1;  // Right or back
+            inStop = -1;                  // Left or front
+            inInc = -1;                   // Zag left
+          }
 
-          #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          zig ^= true; // zag
 
-            const float z = abl.measured_z + abl.Z_offset;
-            abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
-            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
+          // An index to print current state
+          uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
 
-          #endif
+          // Inner loop is Y with PROBE_Y_FIRST enabled
+          // Inner loop is X with PROBE_Y_FIRST disabled
+          for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc)
+            if (!probe_grid_point(pt_index)) break; // Breaks out of both loops
 
-          abl.reenable = false; // Don't re-enable after modifying the mesh
-          idle_no_sleep();
+        } // outer
 
-        } // inner
-      } // outer
+      #endif
 
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
@@ -815,6 +972,9 @@ G29_TYPE GcodeSuite::G29() {
         COPY(bedlevel.z_values, abl.z_values);
         TERN_(IS_KINEMATIC, bedlevel.extrapolate_unprobed_bed_level());
         bedlevel.refresh_bed_level();
+        TERN_(BILINEAR_MESH_SLOTS, bedlevel.mesh_changed = true);
+        TERN_(THERMAL_Z_MODEL, thermal_z.set_mesh_reference());
+        TERN_(BABYSTEP_MESH_FEEDBACK, babystep.clear_mesh_adjustments());
 
         bedlevel.print_leveling_grid();
       }
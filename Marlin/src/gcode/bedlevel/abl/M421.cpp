@@ -63,6 +63,7 @@ void GcodeSuite::M421() {
         }
       }
       bedlevel.refresh_bed_level();
+      TERN_(BILINEAR_MESH_SLOTS, bedlevel.mesh_changed = true);
     }
     else
       SERIAL_ERROR_MSG(STR_ERR_MESH_XY);
@@ -443,14 +443,18 @@ void GcodeSuite::G28() {
     // Diagonal move first if both are homing
     TERN_(QUICK_HOME, if (doX && doY) quick_home_xy());
 
+    // Home X and Y together, each stopping at its own endstop
+    const bool home_xy_together = TERN0(CONCURRENT_XY_HOMING, doX && doY);
+    TERN_(CONCURRENT_XY_HOMING, if (home_xy_together) homeaxes_xy());
+
     #if HAS_Y_AXIS
       // Home Y (before X)
-      if (ENABLED(HOME_Y_BEFORE_X) && (doY || TERN0(CODEPENDENT_XY_HOMING, doX)))
+      if (!home_xy_together && ENABLED(HOME_Y_BEFORE_X) && (doY || TERN0(CODEPENDENT_XY_HOMING, doX)))
         homeaxis(Y_AXIS);
     #endif
 
     // Home X
-    if (doX || (doY && ENABLED(CODEPENDENT_XY_HOMING) && DISABLED(HOME_Y_BEFORE_X))) {
+    if (!home_xy_together && (doX || (doY && ENABLED(CODEPENDENT_XY_HOMING) && DISABLED(HOME_Y_BEFORE_X)))) {
 
       #if ENABLED(DUAL_X_CARRIAGE)
 
@@ -482,7 +486,7 @@ void GcodeSuite::G28() {
 
     #if HAS_Y_AXIS
       // Home Y (after X)
-      if (DISABLED(HOME_Y_BEFORE_X) && doY)
+      if (!home_xy_together && DISABLED(HOME_Y_BEFORE_X) && doY)
         homeaxis(Y_AXIS);
     #endif
 
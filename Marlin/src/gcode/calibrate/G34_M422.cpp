@@ -77,6 +77,11 @@
  *   T<accuracy>       Target Accuracy factor. If omitted, Z_STEPPER_ALIGN_ACC.
  *   A<amplification>  Provide an Amplification value. If omitted, Z_STEPPER_ALIGN_AMP.
  *   R                 Flag to recalculate points based on current probe offsets
+ *
+ * With Z_STEPPER_ALIGN_PREDICT, after each pass the change in measured deviation is
+ * fitted against the correction that was applied. The fitted gain replaces the
+ * amplification so the next correction should converge in one pass, and points the
+ * model already predicts within the target accuracy are not probed again.
  */
 void GcodeSuite::G34() {
   DEBUG_SECTION(log_G34, "G34", DEBUGGING(LEVELING));
@@ -192,6 +197,15 @@ void GcodeSuite::G34() {
         bool adjustment_reverse = false;
       #endif
 
+      #if ENABLED(Z_STEPPER_ALIGN_PREDICT)
+        // Linear model: z_next = z + gain * move + (shift common to all points)
+        float z_last_measured[NUM_Z_STEPPERS] = { 0 },
+              z_last_move[NUM_Z_STEPPERS] = { 0 },
+              z_residual[NUM_Z_STEPPERS] = { 0 },
+              predict_gain = 0.0f;            // 0 until a pass has been fitted
+        uint8_t probe_skip = 0, probed = 0;   // Stepper bits
+      #endif
+
       #if HAS_STATUS_MESSAGE
         PGM_P const msg_iteration = GET_TEXT(MSG_ITERATION);
         const uint8_t iter_str_len = strlen_P(msg_iteration);
@@ -216,11 +230,22 @@ void GcodeSuite::G34() {
         z_measured_min =  100000.0f;
         float z_measured_max = -100000.0f;
 
+        TERN_(Z_STEPPER_ALIGN_PREDICT, probed = 0);
+
         // Probe all positions (one per Z-Stepper)
         LOOP_L_N(i, NUM_Z_STEPPERS) {
           // iteration odd/even --> downward / upward stepper sequence
           const uint8_t iprobe = (iteration & 1) ? NUM_Z_STEPPERS - 1 - i : i;
 
+          #if ENABLED(Z_STEPPER_ALIGN_PREDICT)
+            // The model predicts this point well enough. Fill it in after probing the rest.
+            if (TEST(probe_skip, iprobe)) {
+              if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("> Z", iprobe + 1, " predicted, not probed");
+              continue;
+            }
+            SBI(probed, iprobe);
+          #endif
+
           // Safe clearance even on an incline
           if ((iteration == 0 || i > 0) && z_probe > current_position.z) do_blocking_move_to_z(z_probe);
 
@@ -253,6 +278,25 @@ void GcodeSuite::G34() {
 
         if (err_break) break;
 
+        #if ENABLED(Z_STEPPER_ALIGN_PREDICT)
+          if (probe_skip) {
+            // The shift common to all points, as seen by the probed points
+            float z_shift = 0.0f;
+            uint8_t n = 0;
+            LOOP_L_N(i, NUM_Z_STEPPERS) if (TEST(probed, i)) {
+              z_shift += z_measured[i] - z_last_measured[i] - predict_gain * z_last_move[i];
+              n++;
+            }
+            z_shift /= n;
+            LOOP_L_N(i, NUM_Z_STEPPERS) if (TEST(probe_skip, i)) {
+              z_measured[i] = z_last_measured[i] + predict_gain * z_last_move[i] + z_shift;
+              if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("> Z", i + 1, " predicted position is ", z_measured[i]);
+              NOMORE(z_measured_min, z_measured[i]);
+              NOLESS(z_measured_max, z_measured[i]);
+            }
+          }
+        #endif
+
         // Adapt the next probe clearance height based on the new measurements.
         // Safe_height = lowest distance to bed (= highest measurement) plus highest measured misalignment.
         z_maxdiff = z_measured_max - z_measured_min;
@@ -362,6 +406,42 @@ void GcodeSuite::G34() {
           last_z_align_level_indicator = z_align_level_indicator;
         #endif
 
+        #if ENABLED(Z_STEPPER_ALIGN_PREDICT)
+          if (iteration) {
+            // Fit the change in deviation (about the mean) to the correction made last pass
+            float dz_mean = 0.0f, move_mean = 0.0f;
+            uint8_t n = 0;
+            LOOP_L_N(i, NUM_Z_STEPPERS) if (TEST(probed, i)) {
+              dz_mean += z_measured[i] - z_last_measured[i];
+              move_mean += z_last_move[i];
+              n++;
+            }
+            if (n >= 2) {
+              dz_mean /= n;
+              move_mean /= n;
+              float sxy = 0.0f, sxx = 0.0f;
+              LOOP_L_N(i, NUM_Z_STEPPERS) if (TEST(probed, i)) {
+                const float mv = z_last_move[i] - move_mean;
+                sxy += (z_measured[i] - z_last_measured[i] - dz_mean) * mv;
+                sxx += sq(mv);
+              }
+              // A correction moves the other steppers' points up by the same amount, so gain is negative
+              const float gain = sxx > 0 ? sxy / sxx : 0.0f;
+              if (gain && WITHIN(ABS(gain), 0.5f, 2.0f)) {
+                predict_gain = gain;
+                amplification = -1.0f / gain;   // The sign of the fit also covers reversed steppers
+                IF_DISABLED(HAS_Z_STEPPER_ALIGN_STEPPER_XY, adjustment_reverse = false);
+                LOOP_L_N(i, NUM_Z_STEPPERS) if (TEST(probed, i))
+                  z_residual[i] = ABS(z_measured[i] - z_last_measured[i] - dz_mean - gain * (z_last_move[i] - move_mean));
+                SERIAL_ECHOLNPGM("Predicted amplification: ", amplification);
+              }
+              else
+                predict_gain = 0.0f;
+            }
+          }
+          probe_skip = 0;
+        #endif
+
         // The following correction actions are to be enabled for select Z-steppers only
         stepper.set_separate_multi_axis(true);
 
@@ -374,10 +454,11 @@ void GcodeSuite::G34() {
 
           #if !HAS_Z_STEPPER_ALIGN_STEPPER_XY
             // Optimize one iteration's correction based on the first measurements
-            if (z_align_abs) amplification = (iteration == 1) ? _MIN(last_z_align_move[zstepper] / z_align_abs, 2.0f) : z_auto_align_amplification;
+            if (z_align_abs && !TERN0(Z_STEPPER_ALIGN_PREDICT, predict_gain))
+              amplification = (iteration == 1) ? _MIN(last_z_align_move[zstepper] / z_align_abs, 2.0f) : z_auto_align_amplification;
 
-            // Check for less accuracy compared to last move
-            if (decreasing_accuracy(last_z_align_move[zstepper], z_align_abs)) {
+            // Check for less accuracy compared to last move. A fitted model already has the right sign.
+            if (!TERN0(Z_STEPPER_ALIGN_PREDICT, predict_gain) && decreasing_accuracy(last_z_align_move[zstepper], z_align_abs)) {
               if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("> Z", zstepper + 1, " last_z_align_move = ", last_z_align_move[zstepper]);
               if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("> Z", zstepper + 1, " z_align_abs = ", z_align_abs);
               adjustment_reverse = !adjustment_reverse;
@@ -407,8 +488,30 @@ void GcodeSuite::G34() {
 
           // Do a move to correct part of the misalignment for the current stepper
           do_blocking_move_to_z(amplification * z_align_move + current_position.z);
+
+          #if ENABLED(Z_STEPPER_ALIGN_PREDICT)
+            const float move = amplification * z_align_move;
+            #if !HAS_Z_STEPPER_ALIGN_STEPPER_XY
+              // Skip the point next pass if the model error, scaled to this move, is within accuracy
+              if (predict_gain && TEST(probed, zstepper)) {
+                const float last_move = ABS(z_last_move[zstepper]),
+                            uncertainty = last_move > 0.001f ? z_residual[zstepper] * ABS(move) / last_move : z_residual[zstepper];
+                if (uncertainty < z_auto_align_accuracy) SBI(probe_skip, zstepper);
+              }
+            #endif
+            z_last_measured[zstepper] = z_measured[zstepper];
+            z_last_move[zstepper] = move;
+          #endif
         } // for (zstepper)
 
+        #if ENABLED(Z_STEPPER_ALIGN_PREDICT)
+          // Keep at least two points probed so the deviation between them is measured
+          uint8_t to_probe = NUM_Z_STEPPERS;
+          LOOP_L_N(i, NUM_Z_STEPPERS) if (TEST(probe_skip, i)) {
+            if (to_probe > 2) to_probe--; else CBI(probe_skip, i);
+          }
+        #endif
+
         // Back to normal stepper operations
         stepper.set_all_z_lock(false);
         stepper.set_separate_multi_axis(false);
@@ -0,0 +1,113 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(THERMAL_Z_MODEL)
+
+#include "../gcode.h"
+#include "../../feature/thermal_z_model.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../module/probe.h"
+#include "../../module/temperature.h"
+
+/**
+ * M1011: Thermal Z drift model
+ *
+ *   S       Probe at the current XY and add a sample at the current temperatures,
+ *           then refit the model once there are enough samples
+ *   C       Clear the samples
+ *   E<bool> Enable or disable the correction
+ *   B<mm>   Set the Z change per °C of bed temperature
+ *   H<mm>   Set the Z change per °C of nozzle temperature
+ *   R       Measure the drift from the current temperatures
+ *
+ * Type M1011 without any arguments to show active values.
+ *
+ * Example: After G28, probe with M1011 S while the bed and nozzle
+ * heat and cool on different schedules, then save with M500.
+ */
+void GcodeSuite::M1011() {
+  bool noArgs = true;
+
+  if (parser.seen_test('C')) {
+    thermal_z.clear_samples();
+    noArgs = false;
+  }
+
+  if (parser.seen_test('S')) {
+    noArgs = false;
+    if (homing_needed_error()) return;
+
+    const celsius_float_t bed = thermalManager.degBed(), hotend = thermalManager.degHotend(0);
+    const float measured_z = probe.probe_at_point(current_position, PROBE_PT_RAISE, 0);
+    if (isnan(measured_z)) return;
+
+    thermal_z.add_sample(bed, hotend, measured_z);
+    SERIAL_ECHOLNPGM("Sample ", thermal_z.sample_count(), " Bed: ", bed, " Hotend: ", hotend, " Z: ", measured_z);
+    if (thermal_z.sample_count() >= 3 && !thermal_z.fit())
+      SERIAL_ECHOLNPGM("Vary the bed and nozzle temperature separately to fit the model.");
+  }
+
+  if (parser.seenval('B')) {
+    thermal_z.settings.bed_slope = parser.value_float();
+    noArgs = false;
+  }
+
+  if (parser.seenval('H')) {
+    thermal_z.settings.hotend_slope = parser.value_float();
+    noArgs = false;
+  }
+
+  if (parser.seen('E')) {
+    thermal_z.settings.enabled = parser.value_bool();
+    noArgs = false;
+  }
+
+  if (parser.seen_test('R')) {
+    planner.synchronize();
+    thermal_z.set_reference();
+    noArgs = false;
+  }
+
+  if (noArgs || parser.seen_test('S')) {
+    SERIAL_ECHOPGM("Thermal Z model ");
+    if (!thermal_z.settings.enabled) SERIAL_ECHOPGM("in");
+    SERIAL_ECHOLNPGM("active:");
+    SERIAL_ECHOPGM("  Bed (mm/C):    B"); SERIAL_ECHO_F(thermal_z.settings.bed_slope, 5); SERIAL_EOL();
+    SERIAL_ECHOPGM("  Hotend (mm/C): H"); SERIAL_ECHO_F(thermal_z.settings.hotend_slope, 5); SERIAL_EOL();
+    SERIAL_ECHOLNPGM("  Samples:       ", thermal_z.sample_count());
+    SERIAL_ECHOLNPGM("  Correction:    ", thermal_z.correction());
+  }
+}
+
+void GcodeSuite::M1011_report(const bool forReplay/*=true*/) {
+  report_heading_etc(forReplay, F(STR_THERMAL_Z_MODEL));
+  SERIAL_ECHOPGM("  M1011 E", AS_DIGIT(thermal_z.settings.enabled), " B");
+  SERIAL_ECHO_F(thermal_z.settings.bed_slope, 5);
+  SERIAL_ECHOPGM(" H");
+  SERIAL_ECHO_F(thermal_z.settings.hotend_slope, 5);
+  SERIAL_EOL();
+}
+
+#endif // THERMAL_Z_MODEL
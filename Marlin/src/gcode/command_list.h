@@ -0,0 +1,862 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * gcode/command_list.h - Every command in the G-code dispatch table
+ *
+ * Define GCODE_CMD(name, letter, code, subcode, flags, handler...) and
+ * include this file. The handler is a statement run for the command.
+ * It may 'return false' to skip the "ok".
+ *
+ * Entries are sorted by letter, code, and subcode so the table can be
+ * bisected. A subcode of GCODE_ANY_SUB matches any subcode and sorts
+ * after the specific ones. The order is checked at compile time.
+ *
+ * No include guard, since the list is expanded more than once.
+ */
+
+#define GCODE_C(N, F, V...)        GCODE_CMD(C##N, 'C', N, GCODE_ANY_SUB, F, V)
+#define GCODE_G(N, F, V...)        GCODE_CMD(G##N, 'G', N, GCODE_ANY_SUB, F, V)
+#define GCODE_G_SUB(N, S, F, V...) GCODE_CMD(G##N##_##S, 'G', N, S, F, V)
+#define GCODE_M(N, F, V...)        GCODE_CMD(M##N, 'M', N, GCODE_ANY_SUB, F, V)
+
+//
+// C-codes
+//
+
+#if HAS_PROBE_SETTINGS
+  GCODE_C(1, 0, C001())
+  #if ENABLED(DGUS_LCD_UI_CREALITY_TOUCH)
+    GCODE_C(100, 0, C100())
+  #endif
+#endif
+
+//
+// G-codes
+//
+
+GCODE_G(0, CMD_MOTION, G0_G1(TERN_(HAS_FAST_MOVES, true)))         // G0: Fast Move
+GCODE_G(1, CMD_MOTION, G0_G1(TERN_(HAS_FAST_MOVES, false)))        // G1: Linear Move
+
+#if ENABLED(ARC_SUPPORT) && DISABLED(SCARA)
+  GCODE_G(2, CMD_MOTION, G2_G3(true))                              // G2: CW ARC
+  GCODE_G(3, CMD_MOTION, G2_G3(false))                             // G3: CCW ARC
+#endif
+
+GCODE_G(4, CMD_BLOCKING, G4())                                     // G4: Dwell
+
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  GCODE_G(5, CMD_MOTION, G5())                                     // G5: Cubic B_spline
+#endif
+
+#if ENABLED(DIRECT_STEPPING)
+  GCODE_G(6, CMD_MOTION, G6())                                     // G6: Direct Stepper Move
+#endif
+
+#if ENABLED(FWRETRACT)
+  GCODE_G(10, CMD_MOTION, G10())                                   // G10: Retract / Swap Retract
+  GCODE_G(11, CMD_MOTION, G11())                                   // G11: Recover / Swap Recover
+#endif
+
+#if ENABLED(NOZZLE_CLEAN_FEATURE)
+  GCODE_G(12, CMD_MOTION, G12())                                   // G12: Nozzle Clean
+#endif
+
+#if ENABLED(CNC_WORKSPACE_PLANES)
+  GCODE_G(17, 0, G17())                                            // G17: Select Plane XY
+  GCODE_G(18, 0, G18())                                            // G18: Select Plane ZX
+  GCODE_G(19, 0, G19())                                            // G19: Select Plane YZ
+#endif
+
+#if ENABLED(INCH_MODE_SUPPORT)
+  GCODE_G(20, 0, G20())                                            // G20: Inch Mode
+  GCODE_G(21, 0, G21())                                            // G21: MM Mode
+#else
+  GCODE_G(21, 0, NOOP)                                             // No error on unknown G21
+#endif
+
+#if ENABLED(G26_MESH_VALIDATION)
+  GCODE_G(26, CMD_MOTION | CMD_BLOCKING, G26())                    // G26: Mesh Validation Pattern generation
+#endif
+
+#if ENABLED(NOZZLE_PARK_FEATURE)
+  GCODE_G(27, CMD_MOTION, G27())                                   // G27: Nozzle Park
+#endif
+
+GCODE_G(28, CMD_MOTION | CMD_BLOCKING, G28())                      // G28: Home one or more axes
+
+#if HAS_LEVELING
+  GCODE_G(29, CMD_MOTION | CMD_BLOCKING, TERN(G29_RETRY_AND_RECOVER, G29_with_retry, G29)()) // G29: Bed leveling calibration
+#endif
+
+#if HAS_BED_PROBE
+  GCODE_G(30, CMD_MOTION | CMD_BLOCKING, G30())                    // G30: Single Z probe
+  #if ENABLED(Z_PROBE_SLED)
+    GCODE_G(31, CMD_MOTION, G31())                                 // G31: dock the sled
+    GCODE_G(32, CMD_MOTION, G32())                                 // G32: undock the sled
+  #endif
+#endif
+
+#if ENABLED(DELTA_AUTO_CALIBRATION)
+  GCODE_G(33, CMD_MOTION | CMD_BLOCKING, G33())                    // G33: Delta Auto-Calibration
+#endif
+
+#if ANY(Z_MULTI_ENDSTOPS, Z_STEPPER_AUTO_ALIGN, MECHANICAL_GANTRY_CALIBRATION)
+  GCODE_G(34, CMD_MOTION | CMD_BLOCKING, G34())                    // G34: Z Stepper automatic alignment using probe
+#endif
+
+#if ENABLED(ASSISTED_TRAMMING)
+  GCODE_G(35, CMD_MOTION | CMD_BLOCKING, G35())                    // G35: Read four bed corners to help adjust bed screws
+#endif
+
+#if ENABLED(G38_PROBE_TARGET)
+  GCODE_G_SUB(38, 2, CMD_MOTION | CMD_BLOCKING, G38(2))            // G38.2: Probe towards target, stop on contact
+  GCODE_G_SUB(38, 3, CMD_MOTION | CMD_BLOCKING, G38(3))            // G38.3: Probe towards target
+  #if ENABLED(G38_PROBE_AWAY)
+    GCODE_G_SUB(38, 4, CMD_MOTION | CMD_BLOCKING, G38(4))          // G38.4: Probe away from target, stop on contact loss
+    GCODE_G_SUB(38, 5, CMD_MOTION | CMD_BLOCKING, G38(5))          // G38.5: Probe away from target
+  #endif
+#endif
+
+#if HAS_MESH
+  GCODE_G(42, CMD_MOTION, G42())                                   // G42: Coordinated move to a mesh point
+#endif
+
+#if ENABLED(CNC_COORDINATE_SYSTEMS)
+  GCODE_G(53, 0, G53())                                            // G53: (prefix) Apply native workspace
+  GCODE_G(54, 0, G54())                                            // G54: Switch to Workspace 1
+  GCODE_G(55, 0, G55())                                            // G55: Switch to Workspace 2
+  GCODE_G(56, 0, G56())                                            // G56: Switch to Workspace 3
+  GCODE_G(57, 0, G57())                                            // G57: Switch to Workspace 4
+  GCODE_G(58, 0, G58())                                            // G58: Switch to Workspace 5
+  GCODE_G(59, 0, G59())                                            // G59.0 - G59.3: Switch to Workspace 6-9
+#endif
+
+#if SAVED_POSITIONS
+  GCODE_G(60, 0, G60())                                            // G60:  save current position
+  GCODE_G(61, 0, G61())                                            // G61:  Apply/restore saved coordinates.
+#endif
+
+#if BOTH(PTC_PROBE, PTC_BED)
+  GCODE_G(76, CMD_MOTION | CMD_BLOCKING, G76())                    // G76: Calibrate first layer compensation values
+#endif
+
+#if ENABLED(GCODE_MOTION_MODES)
+  GCODE_G(80, 0, G80())                                            // G80: Reset the current motion mode
+#endif
+
+GCODE_G(90, 0, set_relative_mode(false))                           // G90: Absolute Mode
+GCODE_G(91, 0, set_relative_mode(true))                            // G91: Relative Mode
+
+GCODE_G(92, 0, G92())                                              // G92: Set current axis position(s)
+
+#if ENABLED(CALIBRATION_GCODE)
+  GCODE_G(425, CMD_MOTION | CMD_BLOCKING, G425())                  // G425: Perform calibration with calibration cube
+#endif
+
+#if ENABLED(DEBUG_GCODE_PARSER)
+  GCODE_G(800, 0, parser.debug())                                  // G800: GCode Parser Test for G
+#endif
+
+//
+// M-codes
+//
+
+#if HAS_RESUME_CONTINUE
+  GCODE_M(0, CMD_BLOCKING, M0_M1())                                // M0: Unconditional stop - Wait for user button press on LCD
+  GCODE_M(1, CMD_BLOCKING, M0_M1())                                // M1: Conditional stop - Wait for user button press on LCD
+#endif
+
+#if HAS_CUTTER
+  GCODE_M(3, 0, M3_M4(false))                                      // M3: Turn ON Laser | Spindle (clockwise), set Power | Speed
+  GCODE_M(4, 0, M3_M4(true ))                                      // M4: Turn ON Laser | Spindle (counter-clockwise), set Power | Speed
+  GCODE_M(5, 0, M5())                                              // M5: Turn OFF Laser | Spindle
+#endif
+
+#if ENABLED(COOLANT_MIST)
+  GCODE_M(7, 0, M7())                                              // M7: Coolant Mist ON
+#endif
+
+#if EITHER(AIR_ASSIST, COOLANT_FLOOD)
+  GCODE_M(8, 0, M8())                                              // M8: Air Assist / Coolant Flood ON
+#endif
+
+#if EITHER(AIR_ASSIST, COOLANT_CONTROL)
+  GCODE_M(9, 0, M9())                                              // M9: Air Assist / Coolant OFF
+#endif
+
+#if ENABLED(AIR_EVACUATION)
+  GCODE_M(10, 0, M10())                                            // M10: Vacuum or Blower motor ON
+  GCODE_M(11, 0, M11())                                            // M11: Vacuum or Blower motor OFF
+#endif
+
+#if ENABLED(EXTERNAL_CLOSED_LOOP_CONTROLLER)
+  GCODE_M(12, 0, M12())                                            // M12: Synchronize and optionally force a CLC set
+#endif
+
+#if ENABLED(EXPECTED_PRINTER_CHECK)
+  GCODE_M(16, 0, M16())                                            // M16: Expected printer check
+#endif
+
+GCODE_M(17, 0, M17())                                              // M17: Enable all stepper motors
+GCODE_M(18, 0, M18_M84())                                          // M18: Disable Steppers / Set Timeout
+
+#if ENABLED(SDSUPPORT)
+  GCODE_M(20, CMD_HOST_ONLY, M20())                                // M20: List SD card
+  GCODE_M(21, 0, M21())                                            // M21: Init SD card
+  GCODE_M(22, 0, M22())                                            // M22: Release SD card
+  GCODE_M(23, 0, M23())                                            // M23: Select file
+  GCODE_M(24, 0, M24())                                            // M24: Start SD print
+  GCODE_M(25, 0, M25())                                            // M25: Pause SD print
+  GCODE_M(26, 0, M26())                                            // M26: Set SD index
+  GCODE_M(27, 0, M27())                                            // M27: Get SD status
+  GCODE_M(28, 0, M28())                                            // M28: Start SD write
+  GCODE_M(29, 0, M29())                                            // M29: Stop SD write
+  GCODE_M(30, 0, M30())                                            // M30 <filename> Delete File
+#endif
+
+GCODE_M(31, CMD_HOST_ONLY, M31())                                  // M31: Report time since the start of SD print or last M109
+
+#if ENABLED(SDSUPPORT)
+  #if HAS_MEDIA_SUBCALLS
+    GCODE_M(32, 0, M32())                                          // M32: Select file and start SD print
+  #endif
+
+  #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+    GCODE_M(33, CMD_HOST_ONLY, M33())                              // M33: Get the long full path to a file or folder
+  #endif
+
+  #if BOTH(SDCARD_SORT_ALPHA, SDSORT_GCODE)
+    GCODE_M(34, 0, M34())                                          // M34: Set SD card sorting options
+  #endif
+#endif
+
+#if ENABLED(DIRECT_PIN_CONTROL)
+  GCODE_M(42, 0, M42())                                            // M42: Change pin state
+#endif
+
+#if ENABLED(PINS_DEBUGGING)
+  GCODE_M(43, 0, M43())                                            // M43: Read pin state
+#endif
+
+#if ENABLED(Z_MIN_PROBE_REPEATABILITY_TEST)
+  GCODE_M(48, CMD_MOTION | CMD_BLOCKING, M48())                    // M48: Z probe repeatability test
+#endif
+
+#if ENABLED(SET_PROGRESS_MANUALLY)
+  GCODE_M(73, 0, M73())                                            // M73: Set progress percentage
+#endif
+
+GCODE_M(75, 0, M75())                                              // M75: Start print timer
+GCODE_M(76, 0, M76())                                              // M76: Pause print timer
+GCODE_M(77, 0, M77())                                              // M77: Stop print timer
+
+#if ENABLED(PRINTCOUNTER)
+  GCODE_M(78, 0, M78())                                            // M78: Show print statistics
+#endif
+
+#if ENABLED(PSU_CONTROL)
+  GCODE_M(80, 0, M80())                                            // M80: Turn on Power Supply
+#endif
+GCODE_M(81, 0, M81())                                              // M81: Turn off Power, including Power Supply, if possible
+
+#if HAS_EXTRUDERS
+  GCODE_M(82, 0, M82())                                            // M82: Set E axis normal mode (same as other axes)
+  GCODE_M(83, 0, M83())                                            // M83: Set E axis relative mode
+#endif
+GCODE_M(84, 0, M18_M84())                                          // M84: Disable Steppers / Set Timeout
+GCODE_M(85, 0, M85())                                              // M85: Set inactivity stepper shutdown timeout
+GCODE_M(92, 0, M92())                                              // M92: Set the steps-per-unit for one or more axes
+
+#if ENABLED(M100_FREE_MEMORY_WATCHER)
+  GCODE_M(100, 0, M100())                                          // M100: Free Memory Report
+#endif
+
+#if ENABLED(BD_SENSOR)
+  GCODE_M(102, 0, M102())                                          // M102: Configure Bed Distance Sensor
+#endif
+
+#if HAS_EXTRUDERS
+  GCODE_M(104, 0, M104())                                          // M104: Set hot end temperature
+#endif
+
+GCODE_M(105, CMD_HOST_ONLY, M105(); return false)                  // M105: Report Temperatures (and say "ok")
+
+#if HAS_FAN
+  GCODE_M(106, 0, M106())                                          // M106: Fan On
+  GCODE_M(107, 0, M107())                                          // M107: Fan Off
+#endif
+
+// With EMERGENCY_PARSER these are handled as soon as they are received
+GCODE_M(108, 0, TERN(EMERGENCY_PARSER, NOOP, M108()))              // M108: Cancel Waiting
+
+#if HAS_EXTRUDERS
+  GCODE_M(109, CMD_BLOCKING, M109())                               // M109: Wait for hotend temperature to reach target
+#endif
+
+GCODE_M(110, 0, M110())                                            // M110: Set Current Line Number
+GCODE_M(111, 0, M111())                                            // M111: Set debug level
+GCODE_M(112, 0, TERN(EMERGENCY_PARSER, NOOP, M112()))              // M112: Full Shutdown
+
+#if ENABLED(HOST_KEEPALIVE_FEATURE)
+  GCODE_M(113, 0, M113())                                          // M113: Set Host Keepalive interval
+#endif
+
+GCODE_M(114, 0, M114())                                            // M114: Report current position
+GCODE_M(115, CMD_HOST_ONLY, M115())                                // M115: Report capabilities
+
+GCODE_M(117, 0, TERN_(HAS_STATUS_MESSAGE, M117()))                 // M117: Set LCD message text, if possible
+
+GCODE_M(118, 0, M118())                                            // M118: Display a message in the host console
+GCODE_M(119, CMD_HOST_ONLY, M119())                                // M119: Report endstop states
+GCODE_M(120, 0, M120())                                            // M120: Enable endstops
+GCODE_M(121, 0, M121())                                            // M121: Disable endstops
+
+#if HAS_TRINAMIC_CONFIG
+  GCODE_M(122, 0, M122())                                          // M122: Report driver configuration and status
+#endif
+
+#if HAS_FANCHECK
+  GCODE_M(123, 0, M123())                                          // M123: Report fan states or set fans auto-report interval
+#endif
+
+#if ENABLED(PARK_HEAD_ON_PAUSE)
+  GCODE_M(125, CMD_MOTION | CMD_BLOCKING, M125())                  // M125: Store current position and move to filament change position
+#endif
+
+#if ENABLED(BARICUDA)
+  // PWM for HEATER_1_PIN
+  #if HAS_HEATER_1
+    GCODE_M(126, 0, M126())                                        // M126: valve open
+    GCODE_M(127, 0, M127())                                        // M127: valve closed
+  #endif
+
+  // PWM for HEATER_2_PIN
+  #if HAS_HEATER_2
+    GCODE_M(128, 0, M128())                                        // M128: valve open
+    GCODE_M(129, 0, M129())                                        // M129: valve closed
+  #endif
+#endif // BARICUDA
+
+#if HAS_HEATED_BED
+  GCODE_M(140, 0, M140())                                          // M140: Set bed temperature
+#endif
+
+#if HAS_HEATED_CHAMBER
+  GCODE_M(141, 0, M141())                                          // M141: Set chamber temperature
+#endif
+
+#if HAS_COOLER
+  GCODE_M(143, 0, M143())                                          // M143: Set cooler temperature
+#endif
+
+#if HAS_PREHEAT
+  GCODE_M(145, 0, M145())                                          // M145: Set material heatup parameters
+#endif
+
+#if ENABLED(TEMPERATURE_UNITS_SUPPORT)
+  GCODE_M(149, 0, M149())                                          // M149: Set temperature units
+#endif
+
+#if HAS_COLOR_LEDS
+  GCODE_M(150, 0, M150())                                          // M150: Set Status LED Color
+#endif
+
+#if ENABLED(AUTO_REPORT_POSITION)
+  GCODE_M(154, 0, M154())                                          // M154: Set position auto-report interval
+#endif
+
+#if BOTH(AUTO_REPORT_TEMPERATURES, HAS_TEMP_SENSOR)
+  GCODE_M(155, 0, M155())                                          // M155: Set temperature auto-report interval
+#endif
+
+#if ENABLED(MIXING_EXTRUDER)
+  GCODE_M(163, 0, M163())                                          // M163: Set a component weight for mixing extruder
+  GCODE_M(164, 0, M164())                                          // M164: Save current mix as a virtual extruder
+  #if ENABLED(DIRECT_MIXING_IN_G1)
+    GCODE_M(165, 0, M165())                                        // M165: Set multiple mix weights
+  #endif
+  #if ENABLED(GRADIENT_MIX)
+    GCODE_M(166, 0, M166())                                        // M166: Set Gradient Mix
+  #endif
+#endif
+
+#if HAS_HEATED_BED
+  GCODE_M(190, CMD_BLOCKING, M190())                               // M190: Wait for bed temperature to reach target
+#endif
+
+#if HAS_HEATED_CHAMBER
+  GCODE_M(191, CMD_BLOCKING, M191())                               // M191: Wait for chamber temperature to reach target
+#endif
+
+#if HAS_TEMP_PROBE
+  GCODE_M(192, CMD_BLOCKING, M192())                               // M192: Wait for probe temp
+#endif
+
+#if HAS_COOLER
+  GCODE_M(193, CMD_BLOCKING, M193())                               // M193: Wait for cooler temperature to reach target
+#endif
+
+#if DISABLED(NO_VOLUMETRICS)
+  GCODE_M(200, 0, M200())                                          // M200: Set filament diameter, E to cubic units
+#endif
+
+GCODE_M(201, 0, M201())                                            // M201: Set max acceleration for print moves (units/s^2)
+
+#if 0
+  GCODE_M(202, 0, M202())                                          // M202: Not used for Sprinter/grbl gen6
+#endif
+
+GCODE_M(203, 0, M203())                                            // M203: Set max feedrate (units/sec)
+GCODE_M(204, 0, M204())                                            // M204: Set acceleration
+GCODE_M(205, 0, M205())                                            // M205: Set advanced settings
+
+#if HAS_M206_COMMAND
+  GCODE_M(206, 0, M206())                                          // M206: Set home offsets
+#endif
+
+#if ENABLED(FWRETRACT)
+  GCODE_M(207, 0, M207())                                          // M207: Set Retract Length, Feedrate, and Z lift
+  GCODE_M(208, 0, M208())                                          // M208: Set Recover (unretract) Additional Length and Feedrate
+  #if ENABLED(FWRETRACT_AUTORETRACT)
+    GCODE_M(209, 0, if (MIN_AUTORETRACT <= MAX_AUTORETRACT) M209()) // M209: Turn Automatic Retract Detection on/off
+  #endif
+#endif
+
+#if HAS_SOFTWARE_ENDSTOPS
+  GCODE_M(211, 0, M211())                                          // M211: Enable, Disable, and/or Report software endstops
+#endif
+
+#if HAS_MULTI_EXTRUDER
+  GCODE_M(217, 0, M217())                                          // M217: Set filament swap parameters
+#endif
+
+#if HAS_HOTEND_OFFSET
+  GCODE_M(218, 0, M218())                                          // M218: Set a tool offset
+#endif
+
+GCODE_M(220, 0, M220())                                            // M220: Set Feedrate Percentage: S<percent> ("FR" on your LCD)
+
+#if HAS_EXTRUDERS
+  GCODE_M(221, 0, M221())                                          // M221: Set Flow Percentage
+#endif
+
+#if ENABLED(DIRECT_PIN_CONTROL)
+  GCODE_M(226, CMD_BLOCKING, M226())                               // M226: Wait until a pin reaches a state
+#endif
+
+#if ENABLED(PHOTO_GCODE)
+  GCODE_M(240, 0, M240())                                          // M240: Trigger a camera
+#endif
+
+#if HAS_LCD_CONTRAST
+  GCODE_M(250, 0, M250())                                          // M250: Set LCD contrast
+#endif
+
+#if HAS_GCODE_M255
+  GCODE_M(255, 0, M255())                                          // M255: Set LCD Sleep/Backlight Timeout (Minutes)
+#endif
+
+#if HAS_LCD_BRIGHTNESS
+  GCODE_M(256, 0, M256())                                          // M256: Set LCD brightness
+#endif
+
+#if ENABLED(EXPERIMENTAL_I2CBUS)
+  GCODE_M(260, 0, M260())                                          // M260: Send data to an i2c slave
+  GCODE_M(261, 0, M261())                                          // M261: Request data from an i2c slave
+#endif
+
+#if HAS_SERVOS
+  GCODE_M(280, 0, M280())                                          // M280: Set servo position absolute
+  #if ENABLED(EDITABLE_SERVO_ANGLES)
+    GCODE_M(281, 0, M281())                                        // M281: Set servo angles
+  #endif
+  #if ENABLED(SERVO_DETACH_GCODE)
+    GCODE_M(282, 0, M282())                                        // M282: Detach servo
+  #endif
+#endif
+
+#if ENABLED(BABYSTEPPING)
+  GCODE_M(290, 0, M290())                                          // M290: Babystepping
+#endif
+
+#if HAS_SOUND
+  GCODE_M(300, 0, M300())                                          // M300: Play beep tone
+#endif
+
+#if ENABLED(PIDTEMP)
+  GCODE_M(301, 0, M301())                                          // M301: Set hotend PID parameters
+#endif
+
+#if ENABLED(PREVENT_COLD_EXTRUSION)
+  GCODE_M(302, 0, M302())                                          // M302: Allow cold extrudes (set the minimum extrude temperature)
+#endif
+
+#if HAS_PID_HEATING
+  GCODE_M(303, CMD_BLOCKING, M303())                               // M303: PID autotune
+#endif
+
+#if ENABLED(PIDTEMPBED)
+  GCODE_M(304, 0, M304())                                          // M304: Set bed PID parameters
+#endif
+
+#if HAS_USER_THERMISTORS
+  GCODE_M(305, 0, M305())                                          // M305: Set user thermistor parameters
+#endif
+
+#if ENABLED(MPCTEMP)
+  GCODE_M(306, CMD_BLOCKING, M306())                               // M306: MPC autotune
+#endif
+
+#if ENABLED(PIDTEMPCHAMBER)
+  GCODE_M(309, 0, M309())                                          // M309: Set chamber PID parameters
+#endif
+
+#if HAS_MICROSTEPS
+  GCODE_M(350, 0, M350())                                          // M350: Set microstepping mode. Warning: Steps per unit remains unchanged. S code sets stepping mode for all drivers.
+  GCODE_M(351, 0, M351())                                          // M351: Toggle MS1 MS2 pins directly, S# determines MS1 or MS2, X# sets the pin high/low.
+#endif
+
+#if ENABLED(CASE_LIGHT_ENABLE)
+  GCODE_M(355, 0, M355())                                          // M355: Set case light brightness
+#endif
+
+#if ENABLED(REPETIER_GCODE_M360)
+  GCODE_M(360, CMD_MOTION, M360())                                 // M360: Firmware settings
+#endif
+
+#if ENABLED(MORGAN_SCARA)
+  GCODE_M(360, CMD_MOTION, if (M360()) return false)               // M360: SCARA Theta pos1
+  GCODE_M(361, CMD_MOTION, if (M361()) return false)               // M361: SCARA Theta pos2
+  GCODE_M(362, CMD_MOTION, if (M362()) return false)               // M362: SCARA Psi pos1
+  GCODE_M(363, CMD_MOTION, if (M363()) return false)               // M363: SCARA Psi pos2
+  GCODE_M(364, CMD_MOTION, if (M364()) return false)               // M364: SCARA Psi pos3 (90 deg to Theta)
+#endif
+
+#if EITHER(EXT_SOLENOID, MANUAL_SOLENOID_CONTROL)
+  GCODE_M(380, 0, M380())                                          // M380: Activate solenoid on active (or specified) extruder
+  GCODE_M(381, 0, M381())                                          // M381: Disable all solenoids or, if MANUAL_SOLENOID_CONTROL, active (or specified) solenoid
+#endif
+
+GCODE_M(400, CMD_BLOCKING, M400())                                 // M400: Finish all moves
+
+#if HAS_BED_PROBE
+  GCODE_M(401, CMD_MOTION, M401())                                 // M401: Deploy probe
+  GCODE_M(402, CMD_MOTION, M402())                                 // M402: Stow probe
+#endif
+
+#if HAS_PRUSA_MMU2
+  GCODE_M(403, 0, M403())
+#endif
+
+#if ENABLED(FILAMENT_WIDTH_SENSOR)
+  GCODE_M(404, 0, M404())                                          // M404: Enter the nominal filament width (3mm, 1.75mm ) N<3.0> or display nominal filament width
+  GCODE_M(405, 0, M405())                                          // M405: Turn on filament sensor for control
+  GCODE_M(406, 0, M406())                                          // M406: Turn off filament sensor for control
+  GCODE_M(407, 0, M407())                                          // M407: Display measured filament diameter
+#endif
+
+GCODE_M(410, 0, TERN(EMERGENCY_PARSER, NOOP, M410()))              // M410: Quickstop - Abort all the planned moves.
+
+#if HAS_FILAMENT_SENSOR
+  GCODE_M(412, 0, M412())                                          // M412: Enable/Disable filament runout detection
+#endif
+
+#if ENABLED(POWER_LOSS_RECOVERY)
+  GCODE_M(413, 0, M413())                                          // M413: Enable/disable/query Power-Loss Recovery
+#endif
+
+#if HAS_MULTI_LANGUAGE
+  GCODE_M(414, 0, M414())                                          // M414: Select multi language menu
+#endif
+
+#if HAS_LEVELING
+  GCODE_M(420, 0, M420())                                          // M420: Enable/Disable Bed Leveling
+#endif
+
+#if HAS_MESH
+  GCODE_M(421, 0, M421())                                          // M421: Set a Mesh Bed Leveling Z coordinate
+#endif
+
+#if ENABLED(Z_STEPPER_AUTO_ALIGN)
+  GCODE_M(422, 0, M422())                                          // M422: Set Z Stepper automatic alignment position using probe
+#endif
+
+#if ENABLED(X_AXIS_TWIST_COMPENSATION)
+  GCODE_M(423, 0, M423())                                          // M423: Reset, modify, or report X-Twist Compensation data
+#endif
+
+#if ENABLED(BACKLASH_GCODE)
+  GCODE_M(425, 0, M425())                                          // M425: Tune backlash compensation
+#endif
+
+#if HAS_M206_COMMAND
+  GCODE_M(428, 0, M428())                                          // M428: Apply current_position to home_offset
+#endif
+
+#if HAS_POWER_MONITOR
+  GCODE_M(430, 0, M430())                                          // M430: Read the system current (A), voltage (V), and power (W)
+#endif
+
+#if ENABLED(CANCEL_OBJECTS)
+  GCODE_M(486, 0, M486())                                          // M486: Identify and cancel objects
+#endif
+
+GCODE_M(500, CMD_BLOCKING, M500())                                 // M500: Store settings in EEPROM
+GCODE_M(501, CMD_BLOCKING, M501())                                 // M501: Read settings from EEPROM
+GCODE_M(502, CMD_BLOCKING, M502())                                 // M502: Revert to default settings
+#if DISABLED(DISABLE_M503)
+  GCODE_M(503, CMD_HOST_ONLY, M503())                              // M503: print settings currently in memory
+#endif
+#if ENABLED(EEPROM_SETTINGS)
+  GCODE_M(504, CMD_HOST_ONLY, M504())                              // M504: Validate EEPROM contents
+#endif
+
+#if ENABLED(PASSWORD_FEATURE)
+  GCODE_M(510, 0, M510())                                          // M510: Lock Printer
+  #if ENABLED(PASSWORD_UNLOCK_GCODE)
+    GCODE_M(511, 0, M511())                                        // M511: Unlock Printer
+  #endif
+  #if ENABLED(PASSWORD_CHANGE_GCODE)
+    GCODE_M(512, 0, M512())                                        // M512: Set/Change/Remove Password
+  #endif
+#endif
+
+#if ENABLED(SDSUPPORT)
+  GCODE_M(524, 0, M524())                                          // M524: Abort the current SD print job
+#endif
+
+#if ENABLED(SD_ABORT_ON_ENDSTOP_HIT)
+  GCODE_M(540, 0, M540())                                          // M540: Set abort on endstop hit for SD printing
+#endif
+
+#if HAS_ETHERNET
+  GCODE_M(552, 0, M552())                                          // M552: Set IP address
+  GCODE_M(553, 0, M553())                                          // M553: Set gateway
+  GCODE_M(554, 0, M554())                                          // M554: Set netmask
+#endif
+
+#if BOTH(HAS_TRINAMIC_CONFIG, HAS_STEALTHCHOP)
+  GCODE_M(569, 0, M569())                                          // M569: Enable stealthChop on an axis.
+#endif
+
+#if ENABLED(BAUD_RATE_GCODE)
+  GCODE_M(575, 0, M575())                                          // M575: Set serial baudrate
+#endif
+
+#if HAS_SHAPING
+  GCODE_M(593, 0, M593())                                          // M593: Set Input Shaping parameters
+#endif
+
+#if ENABLED(ADVANCED_PAUSE_FEATURE)
+  GCODE_M(600, CMD_MOTION | CMD_BLOCKING, M600())                  // M600: Pause for Filament Change
+  GCODE_M(603, 0, M603())                                          // M603: Configure Filament Change
+#endif
+
+#if HAS_DUPLICATION_MODE
+  GCODE_M(605, 0, M605())                                          // M605: Set Dual X Carriage movement mode
+#endif
+
+#if IS_KINEMATIC
+  GCODE_M(665, 0, M665())                                          // M665: Set Kinematics parameters
+#endif
+
+#if ENABLED(DELTA) || HAS_EXTRA_ENDSTOPS
+  GCODE_M(666, 0, M666())                                          // M666: Set delta or multiple endstop adjustment
+#endif
+
+#if ENABLED(DUET_SMART_EFFECTOR) && PIN_EXISTS(SMART_EFFECTOR_MOD)
+  GCODE_M(672, 0, M672())                                          // M672: Set/clear Duet Smart Effector sensitivity
+#endif
+
+#if ENABLED(FILAMENT_LOAD_UNLOAD_GCODES)
+  GCODE_M(701, CMD_MOTION | CMD_BLOCKING, M701())                  // M701: Load Filament
+  GCODE_M(702, CMD_MOTION | CMD_BLOCKING, M702())                  // M702: Unload Filament
+#endif
+
+#if ENABLED(CONTROLLER_FAN_EDITABLE)
+  GCODE_M(710, 0, M710())                                          // M710: Set Controller Fan settings
+#endif
+
+#if ENABLED(DEBUG_GCODE_PARSER)
+  GCODE_M(800, 0, parser.debug())                                  // M800: GCode Parser Test for M
+#endif
+
+#if ENABLED(GCODE_REPEAT_MARKERS)
+  GCODE_M(808, 0, M808())                                          // M808: Set / Goto repeat markers
+#endif
+
+#if ENABLED(GCODE_MACROS)
+  // M810-M819: Define/execute G-code macro
+  GCODE_M(810, CMD_MOTION, M810_819())
+  GCODE_M(811, CMD_MOTION, M810_819())
+  GCODE_M(812, CMD_MOTION, M810_819())
+  GCODE_M(813, CMD_MOTION, M810_819())
+  GCODE_M(814, CMD_MOTION, M810_819())
+  GCODE_M(815, CMD_MOTION, M810_819())
+  GCODE_M(816, CMD_MOTION, M810_819())
+  GCODE_M(817, CMD_MOTION, M810_819())
+  GCODE_M(818, CMD_MOTION, M810_819())
+  GCODE_M(819, CMD_MOTION, M810_819())
+#endif
+
+#if HAS_BED_PROBE
+  GCODE_M(851, 0, M851())                                          // M851: Set Z Probe Z Offset
+#endif
+
+#if ENABLED(SKEW_CORRECTION_GCODE)
+  GCODE_M(852, 0, M852())                                          // M852: Set Skew factors
+#endif
+
+#if ENABLED(I2C_POSITION_ENCODERS)
+  GCODE_M(860, 0, M860())                                          // M860: Report encoder module position
+  GCODE_M(861, 0, M861())                                          // M861: Report encoder module status
+  GCODE_M(862, 0, M862())                                          // M862: Perform axis test
+  GCODE_M(863, 0, M863())                                          // M863: Calibrate steps/mm
+  GCODE_M(864, 0, M864())                                          // M864: Change module address
+  GCODE_M(865, 0, M865())                                          // M865: Check module firmware version
+  GCODE_M(866, 0, M866())                                          // M866: Report axis error count
+  GCODE_M(867, 0, M867())                                          // M867: Toggle error correction
+  GCODE_M(868, 0, M868())                                          // M868: Set error correction threshold
+  GCODE_M(869, 0, M869())                                          // M869: Report axis error
+#endif
+
+#if HAS_PTC
+  GCODE_M(871, 0, M871())                                          // M871: Print/reset/clear first layer temperature offset values
+#endif
+
+#if ENABLED(HOST_PROMPT_SUPPORT)
+  GCODE_M(876, 0, TERN(EMERGENCY_PARSER, NOOP, M876()))            // M876: Handle Host prompt responses
+#endif
+
+#if ENABLED(LIN_ADVANCE)
+  GCODE_M(900, 0, M900())                                          // M900: Set advance K factor.
+#endif
+
+#if HAS_TRINAMIC_CONFIG
+  GCODE_M(906, 0, M906())                                          // M906: Set motor current in milliamps using axis codes X, Y, Z, E
+#endif
+
+#if ANY(HAS_MOTOR_CURRENT_SPI, HAS_MOTOR_CURRENT_PWM, HAS_MOTOR_CURRENT_I2C, HAS_MOTOR_CURRENT_DAC)
+  GCODE_M(907, 0, M907())                                          // M907: Set digital trimpot motor current using axis codes.
+  #if EITHER(HAS_MOTOR_CURRENT_SPI, HAS_MOTOR_CURRENT_DAC)
+    GCODE_M(908, 0, M908())                                        // M908: Control digital trimpot directly.
+    #if HAS_MOTOR_CURRENT_DAC
+      GCODE_M(909, 0, M909())                                      // M909: Print digipot/DAC current value
+      GCODE_M(910, 0, M910())                                      // M910: Commit digipot/DAC value to external EEPROM
+    #endif
+  #endif
+#endif
+
+#if HAS_TRINAMIC_CONFIG
+  #if ENABLED(MONITOR_DRIVER_STATUS)
+    GCODE_M(911, 0, M911())                                        // M911: Report TMC2130 prewarn triggered flags
+    GCODE_M(912, 0, M912())                                        // M912: Clear TMC2130 prewarn triggered flags
+  #endif
+  #if ENABLED(HYBRID_THRESHOLD)
+    GCODE_M(913, 0, M913())                                        // M913: Set HYBRID_THRESHOLD speed.
+  #endif
+  #if USE_SENSORLESS
+    GCODE_M(914, 0, M914())                                        // M914: Set StallGuard sensitivity.
+  #endif
+  GCODE_M(919, 0, M919())                                          // M919: Set stepper Chopper Times
+#endif
+
+#if ENABLED(SDSUPPORT)
+  GCODE_M(928, 0, M928())                                          // M928: Start SD write
+#endif
+
+#if ENABLED(MAGNETIC_PARKING_EXTRUDER)
+  GCODE_M(951, 0, M951())                                          // M951: Set Magnetic Parking Extruder parameters
+#endif
+
+#if ALL(SPI_FLASH, SDSUPPORT, MARLIN_DEV_MODE)
+  GCODE_M(993, 0, M993())                                          // M993: Backup SPI Flash to SD
+  GCODE_M(994, 0, M994())                                          // M994: Load a Backup from SD to SPI Flash
+#endif
+
+#if ENABLED(TOUCH_SCREEN_CALIBRATION)
+  GCODE_M(995, 0, M995())                                          // M995: Touch screen calibration for TFT display
+#endif
+
+#if ENABLED(PLATFORM_M997_SUPPORT)
+  GCODE_M(997, 0, M997())                                          // M997: Perform in-application firmware update
+#endif
+
+GCODE_M(999, 0, M999())                                            // M999: Restart after being Stopped
+
+#if ENABLED(POWER_LOSS_RECOVERY)
+  GCODE_M(1000, 0, M1000())                                        // M1000: [INTERNAL] Resume from power-loss
+#endif
+
+#if ENABLED(SDSUPPORT)
+  GCODE_M(1001, 0, M1001())                                        // M1001: [INTERNAL] Handle SD completion
+#endif
+
+#if ENABLED(DGUS_LCD_UI_MKS)
+  GCODE_M(1002, CMD_MOTION, M1002())                               // M1002: [INTERNAL] Tool-change and Relative E Move
+#endif
+
+#if ENABLED(UBL_MESH_WIZARD)
+  GCODE_M(1004, CMD_MOTION | CMD_BLOCKING, M1004())                // M1004: UBL Mesh Wizard
+#endif
+
+#if ENABLED(BOOT_PROFILING)
+  GCODE_M(1005, CMD_HOST_ONLY, M1005())                            // M1005: Report boot stage durations
+#endif
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  GCODE_M(1006, 0, M1006())                                        // M1006: Report idle task statistics
+#endif
+
+#if ENABLED(GCODE_COMMAND_TABLE)
+  GCODE_M(1007, 0, M1007())                                        // M1007: List supported commands and counts
+#endif
+
+#if ENABLED(GCODE_PROFILER)
+  GCODE_M(1008, 0, M1008())                                        // M1008: Report G-code handler times
+#endif
+
+#if ENABLED(AUTO_REPORT_TELEMETRY)
+  GCODE_M(1009, 0, M1009())                                        // M1009: Stream telemetry frames
+#endif
+
+#if ENABLED(TMC_HYBRID_TUNING)
+  GCODE_M(1010, CMD_MOTION | CMD_BLOCKING, M1010())                // M1010: Tune TMC hybrid threshold and chopper
+#endif
+
+#if ENABLED(THERMAL_Z_MODEL)
+  GCODE_M(1011, CMD_MOTION | CMD_BLOCKING, M1011())                // M1011: Thermal Z drift model
+#endif
+
+#if ENABLED(HAS_MCP3426_ADC)
+  GCODE_M(3426, 0, M3426())                                        // M3426: Read MCP3426 ADC (over i2c)
+#endif
+
+#if ENABLED(MAX7219_GCODE)
+  GCODE_M(7219, 0, M7219())                                        // M7219: Set LEDs, columns, and rows
+#endif
+
+#undef GCODE_C
+#undef GCODE_G
+#undef GCODE_G_SUB
+#undef GCODE_M
@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_COMMAND_TABLE)
+
+#include "command_table.h"
+#include "gcode.h"
+
+CommandTable command_table;
+
+uint32_t CommandTable::counts[GcodeSuite::COMMAND_COUNT];
+
+void CommandTable::report(const bool used_only) {
+  LOOP_L_N(i, GcodeSuite::COMMAND_COUNT) {
+    if (used_only && !counts[i]) continue;
+    const command_info_t &cmd = GcodeSuite::commands[i];
+    const uint8_t f = pgm_read_byte(&cmd.flags), sub = pgm_read_byte(&cmd.subcode);
+    SERIAL_CHAR(char(pgm_read_byte(&cmd.letter)));
+    SERIAL_ECHO(pgm_read_word(&cmd.code));
+    if (sub != GCODE_ANY_SUB) SERIAL_ECHOPGM(".", sub);
+    SERIAL_ECHOPGM(" runs:", counts[i]);
+    if (f & CMD_MOTION)    SERIAL_ECHOPGM(" motion");
+    if (f & CMD_BLOCKING)  SERIAL_ECHOPGM(" blocking");
+    if (f & CMD_HOST_ONLY) SERIAL_ECHOPGM(" host");
+    SERIAL_EOL();
+  }
+}
+
+void CommandTable::reset_counts() { ZERO(counts); }
+
+#endif // GCODE_COMMAND_TABLE
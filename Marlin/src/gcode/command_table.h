@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * gcode/command_table.h - Entries of the G-code dispatch table and their execution counts
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum CommandFlag : uint8_t {
+  CMD_MOTION    = _BV(0), // Adds moves to the planner
+  CMD_BLOCKING  = _BV(1), // Waits for moves, heaters, or the user
+  CMD_HOST_ONLY = _BV(2)  // Only reports to the host, changing no state
+};
+
+// An entry subcode that matches any subcode
+#define GCODE_ANY_SUB 0xFF
+
+typedef struct {
+  char letter;
+  uint8_t subcode;
+  uint16_t code;
+  uint8_t flags;
+  bool (*run)();          // Returns false to skip the "ok"
+} command_info_t;
+
+#if ENABLED(GCODE_COMMAND_TABLE)
+
+  class CommandTable {
+  public:
+    // Count one execution of the command at an index of GcodeSuite::commands
+    static void count(const uint16_t i) { counts[i]++; }
+
+    static void report(const bool used_only);
+    static void reset_counts();
+
+  private:
+    static uint32_t counts[];
+  };
+
+  extern CommandTable command_table;
+
+#endif
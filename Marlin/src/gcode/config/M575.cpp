@@ -26,11 +26,130 @@
 
 #include "../gcode.h"
 
+#if ENABLED(BAUD_RATE_NEGOTIATION)
+
+#include "../queue.h"
+#include "../../MarlinCore.h"
+#include "../../libs/crc16.h"
+#include "../../libs/hex_print.h"
+
+#ifndef BAUDRATE_2
+  #define BAUDRATE_2 BAUDRATE
+#endif
+#ifndef BAUDRATE_3
+  #define BAUDRATE_3 BAUDRATE
+#endif
+
+// The rate each port is running at, to fall back to
+static int32_t port_baud[] = { BAUDRATE
+  #if HAS_MULTI_SERIAL
+    , BAUDRATE_2
+    #ifdef SERIAL_PORT_3
+      , BAUDRATE_3
+    #endif
+  #endif
+};
+
+static void set_port_baud(const uint8_t p, const int32_t baud) {
+  switch (p) {
+    case 0: MYSERIAL1.end(); MYSERIAL1.begin(baud); break;
+    #if HAS_MULTI_SERIAL
+      case 1: MYSERIAL2.end(); MYSERIAL2.begin(baud); break;
+      #ifdef SERIAL_PORT_3
+        case 2: MYSERIAL3.end(); MYSERIAL3.begin(baud); break;
+      #endif
+    #endif
+  }
+  port_baud[p] = baud;
+}
+
+/**
+ * Read one line from the port into buf, waiting up to BAUD_NEGOTIATION_TIMEOUT ms.
+ * Return false on timeout or overflow.
+ */
+static bool read_test_line(const serial_index_t port, char * const buf, const uint8_t size) {
+  uint8_t len = 0;
+  for (const millis_t end_ms = millis() + (BAUD_NEGOTIATION_TIMEOUT); PENDING(millis(), end_ms);) {
+    const int c = SERIAL_IMPL.read(port);
+    if (c < 0) { idle(); continue; }
+    if (c == '\n' || c == '\r') {
+      if (!len) continue;
+      buf[len] = '\0';
+      return true;
+    }
+    if (len >= size - 1) return false;
+    buf[len++] = c;
+  }
+  return false;
+}
+
+/**
+ * Switch the command's port to a new rate and verify it with the host.
+ * Fall back to the old rate if any step fails or times out.
+ *
+ *  Firmware (old rate): BAUD_NEGOTIATE:<baud>
+ *  Host     (new rate): BAUDTEST:<payload>*<crc>   CRC-16/XMODEM of the payload, 4 hex digits
+ *  Firmware (new rate): BAUDTEST:<payload>*<crc>   Echo with the CRC it computed
+ *  Host     (new rate): BAUDOK
+ */
+static void negotiate_baud(const int32_t baud) {
+  const serial_index_t port = queue.ring_buffer.command_port();
+  if (!port.valid() || port.index >= COUNT(port_baud)) {
+    SERIAL_ERROR_MSG("Baud negotiation needs a serial port.");
+    return;
+  }
+
+  const int32_t old_baud = port_baud[port.index];
+
+  SERIAL_ECHOLNPGM("BAUD_NEGOTIATE:", baud);
+  SERIAL_FLUSHTX();
+  set_port_baud(port.index, baud);
+
+  bool ok = false;
+  char buf[80];
+  if (read_test_line(port, buf, sizeof(buf)) && strncmp_P(buf, PSTR("BAUDTEST:"), 9) == 0) {
+    char * const payload = &buf[9], * const star = strrchr(payload, '*');
+    if (star) {
+      *star = '\0';
+      uint16_t crc = 0;
+      crc16(&crc, payload, star - payload);
+      if (crc == uint16_t(strtoul(star + 1, nullptr, 16))) {
+        SERIAL_ECHOLNPGM("BAUDTEST:", payload, "*", hex_word(crc));
+        ok = read_test_line(port, buf, sizeof(buf)) && strcmp_P(buf, PSTR("BAUDOK")) == 0;
+      }
+    }
+  }
+
+  if (ok)
+    SERIAL_ECHO_MSG(" Serial ", port.index, " baud rate set to ", baud);
+  else {
+    SERIAL_FLUSHTX();
+    set_port_baud(port.index, old_baud);
+    SERIAL_ECHO_MSG("Baud negotiation failed. Serial ", port.index, " stays at ", old_baud);
+  }
+}
+
+#endif // BAUD_RATE_NEGOTIATION
+
 /**
  * M575 - Change serial baud rate
  *
  *   P<index>    - Serial port index. Omit for all.
  *   B<baudrate> - Baud rate (bits per second)
+ *   N           - Negotiate: test the new rate on the command's port
+ *                 and keep it only if the host confirms. (Requires BAUD_RATE_NEGOTIATION)
+ *
+ * Negotiation handshake for M575 N:
+ *
+ *   Firmware (old rate): BAUD_NEGOTIATE:<baud>
+ *   Host     (new rate): BAUDTEST:<payload>*<crc16>
+ *   Firmware (new rate): BAUDTEST:<payload>*<crc16>
+ *   Host     (new rate): BAUDOK
+ *
+ * The CRC is CRC-16/XMODEM over the payload bytes between ':' and the last '*':
+ * polynomial 0x1021, initial value 0x0000, MSB first (no reflection), no final XOR.
+ * It is sent as 4 hex digits, high byte first (e.g., "123456789" gives 31C3).
+ * The payload must not contain a line break and the line must fit in 79 bytes.
  */
 void GcodeSuite::M575() {
   int32_t baud = parser.ulongval('B');
@@ -51,6 +170,10 @@ void GcodeSuite::M575() {
   switch (baud) {
     case 2400: case 9600: case 19200: case 38400: case 57600:
     case 115200: case 250000: case 500000: case 1000000: {
+      #if ENABLED(BAUD_RATE_NEGOTIATION)
+        if (parser.seen_test('N')) { negotiate_baud(baud); break; }
+      #endif
+
       const int8_t port = parser.intval('P', -99);
       const bool set1 = (port == -99 || port == 0);
       if (set1) SERIAL_ECHO_MSG(" Serial ", AS_DIGIT(0), " baud rate set to ", baud);
@@ -65,11 +188,21 @@ void GcodeSuite::M575() {
 
       SERIAL_FLUSH();
 
-      if (set1) { MYSERIAL1.end(); MYSERIAL1.begin(baud); }
-      #if HAS_MULTI_SERIAL
-        if (set2) { MYSERIAL2.end(); MYSERIAL2.begin(baud); }
-        #ifdef SERIAL_PORT_3
-          if (set3) { MYSERIAL3.end(); MYSERIAL3.begin(baud); }
+      #if ENABLED(BAUD_RATE_NEGOTIATION)
+        if (set1) set_port_baud(0, baud);
+        #if HAS_MULTI_SERIAL
+          if (set2) set_port_baud(1, baud);
+          #ifdef SERIAL_PORT_3
+            if (set3) set_port_baud(2, baud);
+          #endif
+        #endif
+      #else
+        if (set1) { MYSERIAL1.end(); MYSERIAL1.begin(baud); }
+        #if HAS_MULTI_SERIAL
+          if (set2) { MYSERIAL2.end(); MYSERIAL2.begin(baud); }
+          #ifdef SERIAL_PORT_3
+            if (set3) { MYSERIAL3.end(); MYSERIAL3.begin(baud); }
+          #endif
         #endif
       #endif
 
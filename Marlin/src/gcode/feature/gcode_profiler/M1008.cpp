@@ -0,0 +1,47 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_PROFILER)
+
+#include "../../gcode.h"
+#include "../../../feature/gcode_profiler.h"
+
+/**
+ * M1008: Report the time spent in each G-code handler
+ *
+ *   R - Reset the profile after reporting
+ *   S - Auto-report interval in seconds. 0 to disable. (Requires AUTO_REPORT_GCODE_PROFILE)
+ */
+void GcodeSuite::M1008() {
+  #if ENABLED(AUTO_REPORT_GCODE_PROFILE)
+    if (parser.seenval('S')) {
+      profiler.auto_reporter.set_interval(parser.value_byte(), 255);
+      return;
+    }
+  #endif
+  profiler.report();
+  if (parser.seen_test('R')) profiler.reset();
+}
+
+#endif // GCODE_PROFILER
@@ -0,0 +1,53 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(AUTO_REPORT_TELEMETRY)
+
+#include "../../gcode.h"
+#include "../../queue.h"
+#include "../../../feature/telemetry.h"
+
+/**
+ * M1009: Stream telemetry frames to the host that sent this command
+ *
+ *   S<ms>  - Interval between frames. 0 to stop. (Minimum TELEMETRY_MIN_INTERVAL)
+ *   F<0|1> - Format. 0 for CSV lines, 1 for binary frames. (Default 0)
+ *
+ * Without S, send one frame now.
+ */
+void GcodeSuite::M1009() {
+  const TelemetryFormat fmt = parser.boolval('F') ? TELEMETRY_BINARY : TELEMETRY_CSV;
+  if (parser.seenval('S')) {
+    TERN_(HAS_MULTI_SERIAL, telemetry.port_mask = SERIAL_PORTMASK(queue.ring_buffer.command_port()));
+    telemetry.set_interval(parser.value_ushort(), fmt);
+  }
+  else {
+    const TelemetryFormat old = telemetry.format;
+    telemetry.format = fmt;
+    telemetry.report();
+    telemetry.format = old;
+  }
+}
+
+#endif // AUTO_REPORT_TELEMETRY
@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(TMC_HYBRID_TUNING)
+
+#include "../../gcode.h"
+#include "../../../feature/tmc_util.h"
+#include "../../../module/motion.h"
+
+#if ENABLED(EEPROM_SETTINGS)
+  #include "../../../module/settings.h"
+#endif
+
+/**
+ * M1010: Tune the hybrid threshold and chopper timing of TMC UART drivers
+ *
+ *   X Y Z  - Axes to tune. (Default all)
+ *   S0     - Don't save the results to EEPROM
+ *
+ * The axes must be homed. Each axis moves back and forth across its middle
+ * at increasing speeds up to its max feedrate. The tuned axes must be homed
+ * again afterward. An axis that fails to tune stops M1010 without saving.
+ */
+void GcodeSuite::M1010() {
+  if (homing_needed_error()) return;
+
+  const bool all = !parser.seen("XYZ");
+  bool tuned = false, failed = false;
+  LOOP_L_N(a, _MIN(NUM_AXES, 3)) {
+    const AxisEnum axis = AxisEnum(a);
+    if (!all && !parser.seen(AXIS_CHAR(axis))) continue;
+    switch (tmc_tune_axis(axis)) {
+      case TMC_TUNE_OK: tuned = true; break;
+      case TMC_TUNE_FAILED: failed = true; break;
+      case TMC_TUNE_NO_DRIVER:
+        if (!all) {
+          SERIAL_CHAR(AXIS_CHAR(axis));
+          SERIAL_ECHOLNPGM(" has no TMC UART driver.");
+        }
+        break;
+    }
+    if (failed) break;
+  }
+
+  #if ENABLED(EEPROM_SETTINGS)
+    if (tuned && !failed && parser.boolval('S', true)) (void)settings.save();
+  #else
+    UNUSED(tuned); UNUSED(failed);
+  #endif
+}
+
+#endif // TMC_HYBRID_TUNING
@@ -258,7 +258,7 @@
  * M553 - Get or set IP netmask. (Requires enabled Ethernet port)
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
- * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M575 - Change the serial baud rate. N to negotiate with the host. (Requires BAUD_RATE_GCODE)
  * M593 - Get or set input shaping parameters. (Requires INPUT_SHAPING_[XY])
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
@@ -319,6 +319,13 @@
  * M995 - Touch screen calibration for TFT display
  * M997 - Perform in-application firmware update
  * M999 - Restart after being stopped by error
+ * M1005 - Report the duration of each boot stage. (Requires BOOT_PROFILING)
+ * M1006 - Report idle task statistics. R to reset. (Requires IDLE_TASK_SCHEDULER)
+ * M1007 - List the supported commands and their execution counts. (Requires GCODE_COMMAND_TABLE)
+ * M1008 - Report the time spent in each G-code handler. R to reset. (Requires GCODE_PROFILER)
+ * M1009 - Stream telemetry frames. S<ms> interval, F1 for binary. (Requires AUTO_REPORT_TELEMETRY)
+ * M1010 - Tune TMC hybrid threshold and chopper timing per axis. (Requires TMC_HYBRID_TUNING)
+ * M1011 - Fit and apply the thermal Z drift model. (Requires THERMAL_Z_MODEL)
  *
  * D... - Custom Development G-code. Add hooks to 'gcode_D.cpp' for developers to test features. (Requires MARLIN_DEV_MODE)
  *        D576 - Set buffer monitoring options. (Requires BUFFER_MONITORING)
@@ -334,6 +341,7 @@
 
 #include "../inc/MarlinConfig.h"
 #include "parser.h"
+#include "command_table.h"
 
 #if ENABLED(I2C_POSITION_ENCODERS)
   #include "../feature/encoder_i2c.h"
@@ -431,6 +439,20 @@ public:
   static void process_parsed_command(const bool no_ok=false);
   static void process_next_command();
 
+  // Index of each G, M, and C command in the dispatch table
+  enum CommandIndex : uint16_t {
+    #define GCODE_CMD(NAME, V...) COMMAND_##NAME,
+    #include "command_list.h"
+    #undef GCODE_CMD
+    COMMAND_COUNT
+  };
+
+  // The dispatch table in PROGMEM, sorted by letter, code, and subcode
+  static const command_info_t commands[COMMAND_COUNT];
+
+  // Index of the entry that handles a command, or -1 if it's not supported
+  static int16_t find_command(const char letter, const uint16_t code, const uint8_t subcode);
+
   // Execute G-code in-place, preserving current G-code parameters
   static void process_subcommands_now(FSTR_P fgcode);
   static void process_subcommands_now(char * gcode);
@@ -481,6 +503,11 @@ private:
 
   friend class MarlinSettings;
 
+  // The handler of each dispatch table entry. Returns false to skip the "ok".
+  #define GCODE_CMD(NAME, V...) static bool run_##NAME();
+  #include "command_list.h"
+  #undef GCODE_CMD
+
   #if ENABLED(MARLIN_DEV_MODE)
     static void D(const int16_t dcode);
   #endif
@@ -1238,6 +1265,35 @@ private:
     static void M1004();
   #endif
 
+  #if ENABLED(BOOT_PROFILING)
+    static void M1005();
+  #endif
+
+  #if ENABLED(IDLE_TASK_SCHEDULER)
+    static void M1006();
+  #endif
+
+  #if ENABLED(GCODE_COMMAND_TABLE)
+    static void M1007();
+  #endif
+
+  #if ENABLED(GCODE_PROFILER)
+    static void M1008();
+  #endif
+
+  #if ENABLED(AUTO_REPORT_TELEMETRY)
+    static void M1009();
+  #endif
+
+  #if ENABLED(TMC_HYBRID_TUNING)
+    static void M1010();
+  #endif
+
+  #if ENABLED(THERMAL_Z_MODEL)
+    static void M1011();
+    static void M1011_report(const bool forReplay=true);
+  #endif
+
   #if ENABLED(HAS_MCP3426_ADC)
     static void M3426();
   #endif
@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_COMMAND_TABLE)
+
+#include "../gcode.h"
+#include "../command_table.h"
+
+/**
+ * M1007: List the supported commands with their execution counts
+ *
+ *   U - Only list the commands that have run
+ *   R - Reset the counts after listing
+ */
+void GcodeSuite::M1007() {
+  command_table.report(parser.seen_test('U'));
+  if (parser.seen_test('R')) command_table.reset_counts();
+}
+
+#endif // GCODE_COMMAND_TABLE
@@ -25,10 +25,19 @@
 
 /**
  * M110: Set Current Line Number
+ *
+ *   N<line>  - The current line number
+ *   W<count> - Numbered lines the host keeps in flight, acknowledged
+ *              in batches. Omit to get one "ok" per line. (Requires SERIAL_ACK_WINDOW)
  */
 void GcodeSuite::M110() {
 
   if (parser.seenval('N'))
     queue.set_current_line_number(parser.value_long());
 
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    const serial_index_t port = queue.ring_buffer.command_port();
+    if (port.valid()) queue.set_ack_window(port, parser.byteval('W'));
+  #endif
+
 }
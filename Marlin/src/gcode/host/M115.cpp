@@ -108,6 +108,12 @@ void GcodeSuite::M115() {
     // SERIAL_XON_XOFF
     cap_line(F("SERIAL_XON_XOFF"), ENABLED(SERIAL_XON_XOFF));
 
+    // BAUD_NEGOTIATION (M575 N)
+    cap_line(F("BAUD_NEGOTIATION"), ENABLED(BAUD_RATE_NEGOTIATION));
+
+    // WINDOWED_OK (M110 W)
+    cap_line(F("WINDOWED_OK"), ENABLED(SERIAL_ACK_WINDOW));
+
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
@@ -120,6 +126,9 @@ void GcodeSuite::M115() {
     // AUTOREPORT_POS (M154)
     cap_line(F("AUTOREPORT_POS"), ENABLED(AUTO_REPORT_POSITION));
 
+    // AUTOREPORT_TELEMETRY (M1009)
+    cap_line(F("AUTOREPORT_TELEMETRY"), ENABLED(AUTO_REPORT_TELEMETRY));
+
     // AUTOREPORT_TEMP (M155)
     cap_line(F("AUTOREPORT_TEMP"), ENABLED(AUTO_REPORT_TEMPERATURES));
 
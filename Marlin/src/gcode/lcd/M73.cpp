@@ -29,6 +29,10 @@
 #include "../../sd/cardreader.h"
 #include "../../libs/numtostr.h"
 
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "../../feature/print_time_estimator.h"
+#endif
+
 #if ENABLED(DWIN_LCD_PROUI)
   #include "../../lcd/e3v2/proui/dwin.h"
 #endif
@@ -64,7 +68,10 @@ void GcodeSuite::M73() {
     #endif
 
     #if ENABLED(SET_REMAINING_TIME)
-      if (parser.seenval('R')) ui.set_remaining_time(60 * parser.value_ulong());
+      if (parser.seenval('R')) {
+        ui.set_remaining_time(60 * parser.value_ulong());
+        TERN_(PRINT_TIME_ESTIMATOR, print_estimator.slicer_time_received());
+      }
     #endif
 
     #if ENABLED(SET_INTERACTION_TIME)
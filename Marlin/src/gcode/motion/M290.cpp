@@ -37,11 +37,17 @@
   #include "../../feature/bedlevel/bedlevel.h"
 #endif
 
+#if ENABLED(BABYSTEP_MESH_FEEDBACK)
+  #include "../../module/settings.h"
+  #include "../../MarlinCore.h"
+#endif
+
 #if ENABLED(BABYSTEP_ZPROBE_OFFSET)
 
   FORCE_INLINE void mod_probe_offset(const_float_t offs) {
     if (TERN1(BABYSTEP_HOTEND_Z_OFFSET, active_extruder == 0)) {
       probe.offset.z += offs;
+      TERN_(BABYSTEP_MESH_FEEDBACK, babystep.record_z_adjustment(offs));
       SERIAL_ECHO_MSG(STR_PROBE_OFFSET " " STR_Z, probe.offset.z);
     }
     else {
@@ -66,8 +72,30 @@
  *
  * With BABYSTEP_ZPROBE_OFFSET:
  *  P0 - Don't adjust the Z probe offset
+ *
+ * With BABYSTEP_MESH_FEEDBACK:
+ *  M  - Move the Z adjustments from the probe offset into the mesh and save.
+ *       Z must be homed again afterward. Refused while a print job is running.
  */
 void GcodeSuite::M290() {
+  #if ENABLED(BABYSTEP_MESH_FEEDBACK)
+    if (parser.seen_test('M')) {
+      // The mesh is rebuilt and Z is unhomed, so never while a job is running
+      if (printingIsActive() || printJobOngoing()) {
+        SERIAL_ERROR_MSG("M290 M not allowed while printing");
+        return;
+      }
+      planner.synchronize();
+      if (babystep.apply_to_mesh()) {
+        TERN_(EEPROM_SETTINGS, settings.save());
+        SERIAL_ECHO_MSG(STR_PROBE_OFFSET " " STR_Z, probe.offset.z);
+      }
+      else
+        SERIAL_ECHO_MSG("No Z adjustments to apply");
+      return;
+    }
+  #endif
+
   #if ENABLED(BABYSTEP_XY)
     LOOP_NUM_AXES(a)
       if (parser.seenval(AXIS_CHAR(a)) || (a == Z_AXIS && parser.seenval('S'))) {
@@ -94,6 +122,10 @@ void GcodeSuite::M290() {
       SERIAL_ECHOLNPGM(STR_PROBE_OFFSET " " STR_Z, probe.offset.z);
     #endif
 
+    #if ENABLED(BABYSTEP_MESH_FEEDBACK)
+      SERIAL_ECHOLNPGM("Mesh Z adjustments: ", babystep.mesh_adjustment_count());
+    #endif
+
     #if ENABLED(BABYSTEP_HOTEND_Z_OFFSET)
     {
       SERIAL_ECHOLNPGM_P(
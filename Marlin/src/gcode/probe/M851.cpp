@@ -28,6 +28,10 @@
 #include "../../feature/bedlevel/bedlevel.h"
 #include "../../module/probe.h"
 
+#if ENABLED(BABYSTEP_MESH_FEEDBACK)
+  #include "../../feature/babystep.h"
+#endif
+
 /**
  * M851: Set the nozzle-to-probe offsets in current units
  */
@@ -80,7 +84,10 @@ void GcodeSuite::M851() {
   }
 
   // Save the new offsets
-  if (ok) probe.offset = offs;
+  if (ok) {
+    probe.offset = offs;
+    TERN_(BABYSTEP_MESH_FEEDBACK, babystep.clear_mesh_adjustments());
+  }
 }
 
 void GcodeSuite::M851_report(const bool forReplay/*=true*/) {
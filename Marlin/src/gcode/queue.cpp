@@ -253,6 +253,20 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   if (command.skip_ok) return;
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    SerialState &serial = serial_state[command_port().index];
+    if (serial.ack_window) {
+      // Numbered lines are acknowledged together later
+      if (command.buffer[0] == 'N') {
+        serial.pending_N = strtol(command.buffer + 1, nullptr, 10);
+        if (!serial.acks_pending++) serial.ack_due_ms = millis() + (SERIAL_ACK_INTERVAL);
+        if (serial.acks_pending >= (serial.ack_window + 1) / 2) send_pending_ack(command_port());
+        return;
+      }
+      // Keep the acknowledgements in order
+      send_pending_ack(command_port());
+    }
+  #endif
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
     char* p = command.buffer;
@@ -275,11 +289,51 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
     if (!serial_ind.valid()) return;              // Optimization here, skip if the command came from SD or Flash Drive
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    SerialState &serial = serial_state[serial_ind.index];
+    if (serial.ack_window) {
+      send_pending_ack(serial_ind);   // The lines before the bad one were processed
+      serial.resend_pending = true;   // The host goes back and resends everything from last_N + 1
+    }
+  #endif
   SERIAL_FLUSH();
   SERIAL_ECHOLNPGM(STR_RESEND, serial_state[serial_ind.index].last_N + 1);
   SERIAL_ECHOLNPGM(STR_OK);
 }
 
+#if ENABLED(SERIAL_ACK_WINDOW)
+
+  void GCodeQueue::set_ack_window(const serial_index_t serial_ind, const uint8_t window) {
+    SerialState &serial = serial_state[serial_ind.index];
+    send_pending_ack(serial_ind);
+    serial.ack_window = _MIN(window, SERIAL_ACK_WINDOW_MAX);
+    serial.resend_pending = false;
+    if (window) SERIAL_ECHO_MSG("ACK_WINDOW:", serial.ack_window);
+  }
+
+  void GCodeQueue::send_pending_ack(const serial_index_t serial_ind) {
+    SerialState &serial = serial_state[serial_ind.index];
+    if (!serial.acks_pending) return;
+    serial.acks_pending = 0;
+    PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
+    SERIAL_ECHOPGM(STR_OK, " N", serial.pending_N);
+    #if ENABLED(ADVANCED_OK)
+      SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - ring_buffer.length);
+    #endif
+    SERIAL_EOL();
+  }
+
+  void GCodeQueue::send_due_acks() {
+    const millis_t ms = millis();
+    LOOP_L_N(p, NUM_SERIAL) {
+      const SerialState &serial = serial_state[p];
+      if (serial.acks_pending && (ring_buffer.empty() || ELAPSED(ms, serial.ack_due_ms)))
+        send_pending_ack(p);
+    }
+  }
+
+#endif // SERIAL_ACK_WINDOW
+
 static bool serial_data_available(serial_index_t index) {
   const int a = SERIAL_IMPL.available(index);
   #if ENABLED(RX_BUFFER_MONITOR) && RX_BUFFER_SIZE
@@ -473,6 +527,8 @@ void GCodeQueue::get_serial_commands() {
           if (gcode_N != serial.last_N + 1 && !M110) {
             // A request-for-resend line was already in transit so we got two - oops!
             if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
+            // Lines sent after a bad line are dropped. The host sends them again.
+            if (TERN0(SERIAL_ACK_WINDOW, serial.resend_pending && gcode_N > serial.last_N)) continue;
             // A corrupted line or too high, indicating a lost line
             gcode_line_error(F(STR_ERR_LINE_NO), p);
             break;
@@ -493,6 +549,7 @@ void GCodeQueue::get_serial_commands() {
           }
 
           serial.last_N = gcode_N;
+          TERN_(SERIAL_ACK_WINDOW, serial.resend_pending = false);
         }
         #if ENABLED(SDSUPPORT)
           // Pronterface "M29" and "M29 " has no line number
@@ -626,6 +683,9 @@ void GCodeQueue::exhaust() {
  */
 void GCodeQueue::advance() {
 
+  // Acknowledge processed lines in batches
+  TERN_(SERIAL_ACK_WINDOW, send_due_acks());
+
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
 
@@ -43,6 +43,13 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(SERIAL_ACK_WINDOW)
+      uint8_t ack_window;           //!< Lines the host may keep in flight. 0 for one "ok" per line.
+      uint8_t acks_pending;         //!< Processed lines not yet acknowledged
+      long pending_N;               //!< Line number of the last processed line
+      millis_t ack_due_ms;          //!< When the pending acknowledgement must go out
+      bool resend_pending;          //!< A resend was requested. Drop later lines until it arrives.
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -206,6 +213,24 @@ public:
    */
   static void set_current_line_number(long n) { serial_state[ring_buffer.command_port().index].last_N = n; }
 
+  #if ENABLED(SERIAL_ACK_WINDOW)
+    /**
+     * Set the number of lines the host may keep in flight (0 to turn off)
+     */
+    static void set_ack_window(const serial_index_t serial_ind, const uint8_t window);
+
+    /**
+     * Send "ok N<line>" for the processed lines not yet acknowledged
+     */
+    static void send_pending_ack(const serial_index_t serial_ind);
+
+    /**
+     * Send the pending acknowledgements that are due, or all of them
+     * once the queue has run dry so the host isn't kept waiting.
+     */
+    static void send_due_acks();
+  #endif
+
   #if ENABLED(BUFFER_MONITORING)
 
     private:
@@ -34,6 +34,10 @@
 #include "../../module/temperature.h"
 #include "../../lcd/marlinui.h"
 
+#if ENABLED(BILINEAR_MESH_SLOT_AUTO_SELECT)
+  #include "../../feature/bedlevel/bedlevel.h"
+#endif
+
 /**
  * M140 - Set Bed Temperature target and return immediately
  * M190 - Set Bed Temperature target and wait
@@ -84,6 +88,11 @@ void GcodeSuite::M140_M190(const bool isM190) {
   thermalManager.setTargetBed(temp);
   thermalManager.isHeatingBed() ? LCD_MESSAGE(MSG_BED_HEATING) : LCD_MESSAGE(MSG_BED_COOLING);
 
+  // Use the mesh that was saved for this bed temperature
+  #if ENABLED(BILINEAR_MESH_SLOT_AUTO_SELECT)
+    if (isM190) bedlevel.select_slot_for_bed(temp);
+  #endif
+
   // With PRINTJOB_TIMER_AUTOSTART, M190 can start the timer, and M140 can stop it
   TERN_(PRINTJOB_TIMER_AUTOSTART, thermalManager.auto_job_check_timer(isM190, !isM190));
 
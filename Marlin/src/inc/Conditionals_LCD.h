@@ -1309,6 +1309,9 @@
 #if EITHER(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_3POINT)
   #define NEEDS_THREE_PROBE_POINTS 1
 #endif
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR) && EITHER(ABL_BILINEAR_SUBDIVISION, BILINEAR_CELL_COEFFICIENTS)
+  #define BILINEAR_NEEDS_REFRESH 1  // Data derived from the mesh must be refreshed when a point changes
+#endif
 #if EITHER(HAS_ABL_NOT_UBL, AUTO_BED_LEVELING_UBL)
   #define HAS_ABL_OR_UBL 1
   #if DISABLED(PROBE_MANUALLY)
@@ -1120,7 +1120,7 @@
 #endif
 
 // Flag whether hex_print.cpp is used
-#if ANY(AUTO_BED_LEVELING_UBL, M100_FREE_MEMORY_WATCHER, DEBUG_GCODE_PARSER, TMC_DEBUG, MARLIN_DEV_MODE, DEBUG_CARDREADER, M20_TIMESTAMP_SUPPORT)
+#if ANY(AUTO_BED_LEVELING_UBL, M100_FREE_MEMORY_WATCHER, DEBUG_GCODE_PARSER, TMC_DEBUG, MARLIN_DEV_MODE, DEBUG_CARDREADER, M20_TIMESTAMP_SUPPORT, BAUD_RATE_NEGOTIATION)
   #define NEED_HEX_PRINT 1
 #endif
 
@@ -1138,8 +1138,13 @@
   #define CASELIGHT_USES_BRIGHTNESS 1
 #endif
 
+// Meshes kept in EEPROM slots
+#if EITHER(AUTO_BED_LEVELING_UBL, BILINEAR_MESH_SLOTS)
+  #define HAS_MESH_SLOTS 1
+#endif
+
 // Flag whether least_squares_fit.cpp is used
-#if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, HAS_Z_STEPPER_ALIGN_STEPPER_XY)
+#if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, HAS_Z_STEPPER_ALIGN_STEPPER_XY, THERMAL_Z_MODEL)
   #define NEED_LSF 1
 #endif
 
@@ -2153,6 +2153,12 @@
 #if ANY_AXIS_HAS(SW_SERIAL)
   #define HAS_TMC_SW_SERIAL 1
 #endif
+#if !HAS_TMC_UART || DISABLED(MONITOR_DRIVER_STATUS)
+  #undef TMC_UART_ASYNC
+#endif
+#if !HAS_TMC_UART || DISABLED(HYBRID_THRESHOLD)
+  #undef TMC_HYBRID_TUNING
+#endif
 
 #if DISABLED(SENSORLESS_HOMING)
   #undef SENSORLESS_BACKOFF_MM
@@ -2655,7 +2661,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS, AUTO_REPORT_GCODE_PROFILE, AUTO_REPORT_TELEMETRY)
   #define HAS_AUTO_REPORTING 1
 #endif
 
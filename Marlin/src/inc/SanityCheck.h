@@ -764,6 +764,43 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif // HAS_PTC
 
+/**
+ * Bilinear probe order requirements
+ */
+#if BOTH(ABL_HILBERT_CURVE, ABL_SHORTEST_PROBE_PATH)
+  #error "Enable only one of ABL_HILBERT_CURVE or ABL_SHORTEST_PROBE_PATH."
+#elif EITHER(ABL_HILBERT_CURVE, ABL_SHORTEST_PROBE_PATH) && DISABLED(AUTO_BED_LEVELING_BILINEAR)
+  #error "ABL_HILBERT_CURVE and ABL_SHORTEST_PROBE_PATH require AUTO_BED_LEVELING_BILINEAR."
+#elif EITHER(ABL_HILBERT_CURVE, ABL_SHORTEST_PROBE_PATH) && ENABLED(PROBE_MANUALLY)
+  #error "ABL_HILBERT_CURVE and ABL_SHORTEST_PROBE_PATH are not available with PROBE_MANUALLY."
+#endif
+
+/**
+ * Bilinear mesh slots requirements
+ */
+#if ENABLED(BILINEAR_MESH_SLOTS)
+  #if DISABLED(EEPROM_SETTINGS)
+    #error "BILINEAR_MESH_SLOTS requires EEPROM_SETTINGS."
+  #elif ENABLED(BILINEAR_MESH_SLOT_AUTO_SELECT) && !HAS_HEATED_BED
+    #error "BILINEAR_MESH_SLOT_AUTO_SELECT requires a heated bed."
+  #endif
+#endif
+
+/**
+ * Thermal Z model requirements
+ */
+#if ENABLED(THERMAL_Z_MODEL)
+  #if DISABLED(BABYSTEPPING)
+    #error "THERMAL_Z_MODEL requires BABYSTEPPING."
+  #elif !HAS_BED_PROBE
+    #error "THERMAL_Z_MODEL requires a bed probe."
+  #elif !HAS_HEATED_BED || !HAS_HOTEND
+    #error "THERMAL_Z_MODEL requires a heated bed and a hotend."
+  #elif IS_KINEMATIC
+    #error "THERMAL_Z_MODEL is not compatible with DELTA or SCARA."
+  #endif
+#endif
+
 /**
  * Marlin release, version and default string
  */
@@ -813,6 +850,14 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
 
+#if ENABLED(BAUD_RATE_NEGOTIATION) && DISABLED(BAUD_RATE_GCODE)
+  #error "BAUD_RATE_NEGOTIATION requires BAUD_RATE_GCODE."
+#endif
+
+#if ENABLED(SERIAL_DMA) && !(defined(__STM32F1__) || defined(__PLAT_LINUX__))
+  #error "SERIAL_DMA is only supported on STM32F1 (Maple) and LINUX."
+#endif
+
 /**
  * Multiple Stepper Drivers Per Axis
  */
@@ -1034,6 +1079,10 @@ static_assert(X_MAX_LENGTH >= X_BED_SIZE, "Movement bounds (X_MIN_POS, X_MAX_POS
     #error "BABYSTEP_ZPROBE_GFX_OVERLAY requires a BABYSTEP_ZPROBE_OFFSET."
   #elif ENABLED(BABYSTEP_HOTEND_Z_OFFSET) && !HAS_HOTEND_OFFSET
     #error "BABYSTEP_HOTEND_Z_OFFSET requires 2 or more HOTENDS."
+  #elif ENABLED(BABYSTEP_MESH_FEEDBACK) && DISABLED(BABYSTEP_ZPROBE_OFFSET)
+    #error "BABYSTEP_MESH_FEEDBACK requires BABYSTEP_ZPROBE_OFFSET."
+  #elif ENABLED(BABYSTEP_MESH_FEEDBACK) && DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "BABYSTEP_MESH_FEEDBACK requires AUTO_BED_LEVELING_BILINEAR."
   #elif BOTH(BABYSTEP_ALWAYS_AVAILABLE, MOVE_Z_WHEN_IDLE)
     #error "BABYSTEP_ALWAYS_AVAILABLE and MOVE_Z_WHEN_IDLE are incompatible."
   #elif !defined(BABYSTEP_MULTIPLICATOR_Z)
@@ -2061,6 +2110,22 @@ static_assert(X_MAX_LENGTH >= X_BED_SIZE, "Movement bounds (X_MIN_POS, X_MAX_POS
   #error "G29_RETRY_AND_RECOVER requires AUTO_BED_LEVELING_3POINT, LINEAR, or BILINEAR."
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATOR) && !BOTH(SDSUPPORT, SET_REMAINING_TIME)
+  #error "PRINT_TIME_ESTIMATOR requires SDSUPPORT and SET_REMAINING_TIME."
+#endif
+
+#if ENABLED(ABL_ADAPTIVE_MESH)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "ABL_ADAPTIVE_MESH requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "ABL_ADAPTIVE_MESH is not compatible with PROBE_MANUALLY."
+  #elif IS_KINEMATIC
+    #error "ABL_ADAPTIVE_MESH is not yet supported for DELTA or SCARA."
+  #elif ADAPTIVE_MESH_MIN_SPACING <= 0
+    #error "ADAPTIVE_MESH_MIN_SPACING must be greater than 0."
+  #endif
+#endif
+
 /**
  * LCD_BED_LEVELING requirements
  */
@@ -2159,6 +2224,16 @@ static_assert(X_MAX_LENGTH >= X_BED_SIZE, "Movement bounds (X_MIN_POS, X_MAX_POS
   #endif
 #endif
 
+#if ENABLED(CONCURRENT_XY_HOMING)
+  #if !HAS_Y_AXIS || IS_KINEMATIC || IS_CORE || EITHER(MARKFORGED_XY, MARKFORGED_YX)
+    #error "CONCURRENT_XY_HOMING requires a Cartesian setup."
+  #elif ANY(QUICK_HOME, HOME_Y_BEFORE_X, CODEPENDENT_XY_HOMING)
+    #error "CONCURRENT_XY_HOMING is incompatible with QUICK_HOME, HOME_Y_BEFORE_X, and CODEPENDENT_XY_HOMING."
+  #elif ANY(DUAL_X_CARRIAGE, X_DUAL_ENDSTOPS, Y_DUAL_ENDSTOPS)
+    #error "CONCURRENT_XY_HOMING is incompatible with DUAL_X_CARRIAGE, X_DUAL_ENDSTOPS, and Y_DUAL_ENDSTOPS."
+  #endif
+#endif
+
 /**
  * Make sure Z_SAFE_HOMING point is reachable
  */
@@ -3961,6 +4036,15 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
                   "BACKLASH_COMPENSATION can only apply to " STRINGIFY(NORMAL_AXIS) " with your CORE system.");
     #endif
   #endif
+  #if ENABLED(BACKLASH_IN_STEPPER)
+    #ifdef BACKLASH_SMOOTHING_MM
+      #error "BACKLASH_SMOOTHING_MM is not compatible with BACKLASH_IN_STEPPER."
+    #elif ENABLED(CORE_BACKLASH)
+      #error "CORE_BACKLASH is not compatible with BACKLASH_IN_STEPPER."
+    #elif !defined(BACKLASH_STEP_RATE) || BACKLASH_STEP_RATE <= 0
+      #error "BACKLASH_IN_STEPPER requires a positive BACKLASH_STEP_RATE."
+    #endif
+  #endif
 #endif
 
 #if ENABLED(GRADIENT_MIX) && MIXING_VIRTUAL_TOOLS < 2
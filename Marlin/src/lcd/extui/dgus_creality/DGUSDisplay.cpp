@@ -40,6 +40,7 @@
 #include "../../../sd/cardreader.h"
 #include "../../../libs/duration_t.h"
 #include "../../../module/printcounter.h"
+#include "../../../libs/crc16.h"
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../../../feature/powerloss.h"
 #endif
@@ -100,16 +101,18 @@ void DGUSDisplay::ReadVariable(uint16_t adr) {
 void DGUSDisplay::WriteVariable(uint16_t adr, const void* values, uint8_t valueslen, bool isstr, char fillChar) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  NOMORE(valueslen, MAX_WRITE_LEN);
+  uint8_t data[MAX_WRITE_LEN];
+  LOOP_L_N(i, valueslen) {
     char x;
     if (!strend) x = *myvalues++;
     if ((isstr && !x) || strend) {
       strend = true;
       x = fillChar;
     }
-    dgusserial.write(x);
+    data[i] = x;
   }
+  WriteData(adr, data, valueslen);
 }
 
 void DGUSDisplay::WriteVariable(uint16_t adr, uint16_t value) {
@@ -162,23 +165,116 @@ void DGUSDisplay::WriteVariable(uint16_t adr, float value) {
 void DGUSDisplay::WriteVariablePGM(uint16_t adr, const void* values, uint8_t valueslen, bool isstr, char fillChar) {
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
-  WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
-  while (valueslen--) {
+  NOMORE(valueslen, MAX_WRITE_LEN);
+  uint8_t data[MAX_WRITE_LEN];
+  LOOP_L_N(i, valueslen) {
     char x;
     if (!strend) x = pgm_read_byte(myvalues++);
     if ((isstr && !x) || strend) {
       strend = true;
       x = fillChar;
     }
-    dgusserial.write(x);
+    data[i] = x;
   }
+  WriteData(adr, data, valueslen);
 }
 
+void DGUSDisplay::WriteData(const uint16_t adr, const uint8_t * const data, const uint8_t len) {
+  #if ENABLED(DGUS_VP_SHADOW)
+    if (batching) return QueueWrite(adr, data, len);
+    InvalidateShadow(adr); // Written outside of the VP updates
+  #endif
+  WriteHeader(adr, DGUS_CMD_WRITEVAR, len);
+  LOOP_L_N(i, len) dgusserial.write(data[i]);
+}
+
+#if ENABLED(DGUS_VP_SHADOW)
+
+  // Addresses below this are display system registers (screen, LEDs, config). Always send those.
+  constexpr uint16_t DGUS_FIRST_USER_VP = 0x1000;
+
+  DGUSDisplay::vp_shadow_t DGUSDisplay::vp_shadow[DGUS_VP_SHADOW_SIZE];
+  millis_t DGUSDisplay::shadow_expire_ms; // = 0
+  bool DGUSDisplay::batching; // = false
+  uint16_t DGUSDisplay::batch_adr;
+  uint8_t DGUSDisplay::batch_len, DGUSDisplay::batch_buf[DGUS_BATCH_SIZE];
+
+  // Open addressing on the VP. When the table is full the home slot is reused.
+  DGUSDisplay::vp_shadow_t& DGUSDisplay::FindShadow(const uint16_t vp) {
+    const uint8_t home = (vp ^ (vp >> 5)) % (DGUS_VP_SHADOW_SIZE);
+    for (uint8_t i = home, n = DGUS_VP_SHADOW_SIZE; n--;) {
+      vp_shadow_t &s = vp_shadow[i];
+      if (s.vp == vp || !s.vp) return s;
+      if (++i == DGUS_VP_SHADOW_SIZE) i = 0;
+    }
+    return vp_shadow[home];
+  }
+
+  void DGUSDisplay::InvalidateShadow(const uint16_t vp) {
+    vp_shadow_t &s = FindShadow(vp);
+    if (s.vp == vp) s.valid = false;
+  }
+
+  void DGUSDisplay::ClearShadow() { ZERO(vp_shadow); }
+
+  void DGUSDisplay::BeginBatch() {
+    const millis_t ms = millis();
+    if (ELAPSED(ms, shadow_expire_ms)) {
+      ClearShadow();
+      shadow_expire_ms = ms + DGUS_VP_SHADOW_REFRESH;
+    }
+    batching = true;
+  }
+
+  // Send the merged writes
+  void DGUSDisplay::EndBatch() {
+    batching = false;
+    if (batch_len) {
+      WriteHeader(batch_adr, DGUS_CMD_WRITEVAR, batch_len);
+      LOOP_L_N(i, batch_len) dgusserial.write(batch_buf[i]);
+      batch_len = 0;
+    }
+  }
+
+  void DGUSDisplay::QueueWrite(const uint16_t adr, const uint8_t * const data, const uint8_t len) {
+    if (adr >= DGUS_FIRST_USER_VP) {
+      uint16_t crc = len;
+      crc16(&crc, data, len);
+      vp_shadow_t &s = FindShadow(adr);
+      if (s.vp == adr && s.valid && s.crc == crc) return; // The display already shows this
+      s = { adr, crc, true };
+
+      // Append to the pending frame if this VP directly follows it
+      const bool follows = batch_len && !(batch_len & 1) && adr == batch_adr + batch_len / 2;
+      if (follows && batch_len + len <= DGUS_BATCH_SIZE) {
+        memcpy(&batch_buf[batch_len], data, len);
+        batch_len += len;
+        return;
+      }
+    }
+
+    EndBatch();
+    if (adr >= DGUS_FIRST_USER_VP && len <= DGUS_BATCH_SIZE) {
+      memcpy(batch_buf, data, len);
+      batch_adr = adr;
+      batch_len = len;
+    }
+    else {
+      WriteHeader(adr, DGUS_CMD_WRITEVAR, len);
+      LOOP_L_N(i, len) dgusserial.write(data[i]);
+    }
+    batching = true;
+  }
+
+#endif // DGUS_VP_SHADOW
+
 void DGUSDisplay::SetVariableDisplayColor(uint16_t sp, uint16_t color) {
   WriteVariable(sp + 0x03, color);
 }
 
-void DGUSDisplay::ProcessRx() {
+// Assemble complete frames from the serial buffer. Handlers are never called
+// from here, so this is safe to run while a handler is still busy.
+void DGUSDisplay::ReceiveFrames() {
 
   #if ENABLED(DGUS_SERIAL_STATS_RX_BUFFER_OVERRUNS)
     if (!dgusserial.available() && dgusserial.buffer_overruns()) {
@@ -211,68 +307,87 @@ void DGUSDisplay::ProcessRx() {
         rx_datagram_len = dgusserial.read();
         //DEBUGLCDCOMM_ECHOPAIR(" (", rx_datagram_len, ") ");
 
-        // Telegram min len is 3 (command and one word of payload)
+        // Telegram min len is 3 (command and one word of payload). It must fit in the serial buffer.
         rx_datagram_state = WITHIN(rx_datagram_len, 3, DGUS_RX_BUFFER_SIZE) ? DGUS_WAIT_TELEGRAM : DGUS_IDLE;
         break;
 
       case DGUS_WAIT_TELEGRAM: // wait for complete datagram to arrive.
         if (dgusserial.available() < rx_datagram_len) return;
 
-        Initialized = true; // We've talked to it, so we defined it as initialized.
-        uint8_t command = dgusserial.read();
+        // Leave it in the serial buffer until the main loop makes room
+        if (rx_frame_count == DGUS_RX_FRAMES) return;
 
-       // DEBUGLCDCOMM_ECHOPAIR("# ", command);
+        Initialized = true; // We've talked to it, so we defined it as initialized.
 
-        uint8_t readlen = rx_datagram_len - 1;  // command is part of len.
-        unsigned char tmp[rx_datagram_len - 1];
-        unsigned char *ptmp = tmp;
-        while (readlen--) {
-          receivedbyte = dgusserial.read();
-          //DEBUGLCDCOMM_ECHOPAIR(" ", receivedbyte);
-          *ptmp++ = receivedbyte;
-        }
-        //DEBUGLCDCOMM_ECHOPGM(" # ");
-        // mostly we'll get this: 5A A5 03 82 4F 4B -- ACK on 0x82, so discard it.
-        if (command == DGUS_CMD_WRITEVAR && 'O' == tmp[0] && 'K' == tmp[1]) {
-          //DEBUG_ECHOLNPGM(">");
-          rx_datagram_state = DGUS_IDLE;
+        rx_frame_t &frame = rx_frames[(rx_frame_head + rx_frame_count) % (DGUS_RX_FRAMES)];
+        frame.command = dgusserial.read();
+        frame.len = rx_datagram_len - 1;  // command is part of len.
+        rx_datagram_state = DGUS_IDLE;
+        if (frame.len > sizeof(frame.data)) {
+          // Longer than any upload with a handler. Drop it.
+          LOOP_L_N(i, frame.len) dgusserial.read();
           break;
         }
+        LOOP_L_N(i, frame.len) frame.data[i] = dgusserial.read();
 
-        /* AutoUpload, (and answer to) Command 0x83 :
-        |      tmp[0  1  2  3  4 ... ]
-        | Example 5A A5 06 83 20 01 01 78 01 ……
-        |          / /  |  |   \ /   |  \     \
-        |        Header |  |    |    |   \_____\_ DATA (Words!)
-        |     DatagramLen  /  VPAdr  |
-        |           Command          DataLen (in Words) */
-        if (command == DGUS_CMD_READVAR) {
-          const uint16_t vp = tmp[0] << 8 | tmp[1];
-
-          //const uint8_t dlen = tmp[2] << 1;  // Convert to Bytes. (Display works with words)
-          //DEBUG_ECHOPGM(" vp=", vp, " dlen=", dlen);
-          DGUS_VP_Variable ramcopy;
-          DEBUG_ECHOLNPGM("VP received: ", vp , " - val ", tmp[3]);
-          if (populate_VPVar(vp, &ramcopy)) {
-            if (ramcopy.set_by_display_handler)
-              ramcopy.set_by_display_handler(ramcopy, &tmp[3]);
-            else
-              DEBUG_ECHOLNPGM(" VPVar found, no handler.");
-          }
-          else
-            DEBUG_ECHOLNPGM(" VPVar not found:", vp);
-
-          rx_datagram_state = DGUS_IDLE;
-          break;
-        }
+        // mostly we'll get this: 5A A5 03 82 4F 4B -- ACK on 0x82, so discard it.
+        if (frame.command == DGUS_CMD_WRITEVAR && 'O' == frame.data[0] && 'K' == frame.data[1]) break;
 
-      // discard anything else
-      rx_datagram_state = DGUS_IDLE;
+        // Only variable uploads have a handler. Discard anything else.
+        if (frame.command == DGUS_CMD_READVAR) rx_frame_count++;
+    }
+  }
+}
+
+// Hand the queued frames to the VP handlers
+void DGUSDisplay::ProcessRx() {
+  while (rx_frame_count) {
+    rx_frame_t &frame = rx_frames[rx_frame_head];
+    unsigned char * const tmp = frame.data;
+
+    /* AutoUpload, (and answer to) Command 0x83 :
+    |      tmp[0  1  2  3  4 ... ]
+    | Example 5A A5 06 83 20 01 01 78 01 ……
+    |          / /  |  |   \ /   |  \     \
+    |        Header |  |    |    |   \_____\_ DATA (Words!)
+    |     DatagramLen  /  VPAdr  |
+    |           Command          DataLen (in Words) */
+
+    // The data words must lie within the frame
+    if (frame.len > sizeof(frame.data) || frame.len < 3 || 3U + (tmp[2] << 1) > frame.len)
+      DEBUG_ECHOLNPGM("Bad frame length: ", frame.len);
+    else {
+      const uint16_t vp = tmp[0] << 8 | tmp[1];
+      TERN_(DGUS_VP_SHADOW, InvalidateShadow(vp)); // The display changed it
+
+      //const uint8_t dlen = tmp[2] << 1;  // Convert to Bytes. (Display works with words)
+      //DEBUG_ECHOPGM(" vp=", vp, " dlen=", dlen);
+      DGUS_VP_Variable ramcopy;
+      DEBUG_ECHOLNPGM("VP received: ", vp , " - val ", tmp[3]);
+      if (populate_VPVar(vp, &ramcopy)) {
+        if (ramcopy.set_by_display_handler)
+          ramcopy.set_by_display_handler(ramcopy, &tmp[3]);
+        else
+          DEBUG_ECHOLNPGM(" VPVar found, no handler.");
+      }
+      else
+        DEBUG_ECHOLNPGM(" VPVar not found:", vp);
     }
+
+    // Free the slot only now, the handler works on the frame data
+    rx_frame_head = (rx_frame_head + 1) % (DGUS_RX_FRAMES);
+    rx_frame_count--;
   }
 }
 
-size_t DGUSDisplay::GetFreeTxBuffer() { return SERIAL_GET_TX_BUFFER_FREE(); }
+size_t DGUSDisplay::GetFreeTxBuffer() {
+  size_t free = SERIAL_GET_TX_BUFFER_FREE();
+  #if ENABLED(DGUS_VP_SHADOW)
+    // Leave room for the pending merged frame
+    if (batch_len) free = free > batch_len + 6U ? free - (batch_len + 6U) : 0;
+  #endif
+  return free;
+}
 
 void DGUSDisplay::WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen) {
   dgusserial.write(DGUS_HEADER1);
@@ -289,6 +404,8 @@ void DGUSDisplay::WritePGM(const char str[], uint8_t len) {
 
 void DGUSDisplay::loop() {
   // protect against recursion… ProcessRx() may indirectly call idle() when injecting gcode commands.
+  // Keep collecting frames while a handler is busy, so the serial buffer can't overflow.
+  ReceiveFrames();
   if (!no_reentrance) {
     no_reentrance = true;
     ProcessRx();
@@ -334,6 +451,8 @@ void DGUSDisplay::SetTouchScreenConfiguration(bool enable_standby, bool enable_s
 
 rx_datagram_state_t DGUSDisplay::rx_datagram_state = DGUS_IDLE;
 uint8_t DGUSDisplay::rx_datagram_len = 0;
+DGUSDisplay::rx_frame_t DGUSDisplay::rx_frames[DGUS_RX_FRAMES];
+uint8_t DGUSDisplay::rx_frame_head, DGUSDisplay::rx_frame_count; // = 0
 bool DGUSDisplay::Initialized = false;
 bool DGUSDisplay::no_reentrance = false;
 DGUSLCD_Screens DGUSDisplay::displayRequest = DGUSLCD_SCREEN_BOOT;
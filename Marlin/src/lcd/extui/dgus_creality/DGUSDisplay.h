@@ -36,6 +36,13 @@
 
 #include "DGUSVPVariable.h"
 
+#ifndef DGUS_RX_FRAMES
+  #define DGUS_RX_FRAMES 4
+#endif
+#ifndef DGUS_RX_FRAME_SIZE
+  #define DGUS_RX_FRAME_SIZE (3 + 8 * 2)  // VP, word count, and up to 8 data words
+#endif
+
 enum DGUSLCD_Screens : uint8_t;
 
 #define DEBUG_OUT ENABLED(DEBUG_DGUSLCD)
@@ -60,6 +67,9 @@ public:
   static void InitDisplay();
   static void ResetDisplay();
 
+  // The longest variable write. The frame length byte also counts the command and the VP address.
+  static constexpr uint8_t MAX_WRITE_LEN = 255 - 3;
+
   // Variable access.
   static void WriteVariable(uint16_t adr, const void* values, uint8_t valueslen, bool isstr=false, char fillChar = ' ');
   static void WriteVariablePGM(uint16_t adr, const void* values, uint8_t valueslen, bool isstr=false, char fillChar = ' ');
@@ -96,6 +106,21 @@ public:
   // Periodic tasks, eg. Rx-Queue handling.
   static void loop();
 
+  #if ENABLED(DGUS_VP_SHADOW)
+    // While a Batch exists VP writes that don't change the value the display
+    // already shows are dropped, and writes to adjacent VPs share one frame.
+    struct Batch {
+      Batch()  { BeginBatch(); }
+      ~Batch() { EndBatch(); }
+    };
+    static void BeginBatch();
+    static void EndBatch();
+
+    // Forget what the display shows, so the next update sends it again
+    static void InvalidateShadow(const uint16_t vp);
+    static void ClearShadow();
+  #endif
+
 public:
   // Helper for users of this class to estimate if an interaction would be blocking.
   static size_t GetFreeTxBuffer();
@@ -106,15 +131,34 @@ public:
 
 private:
   static void WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen);
+  static void WriteData(const uint16_t adr, const uint8_t * const data, const uint8_t len);
   static void WritePGM(const char str[], uint8_t len);
+  static void ReceiveFrames();
   static void ProcessRx();
 
   static inline uint16_t swap16(const uint16_t value) { return (value & 0xffU) << 8U | (value >> 8U); }
   static rx_datagram_state_t rx_datagram_state;
   static uint8_t rx_datagram_len;
+
+  // Complete frames, queued by ReceiveFrames() and handled by ProcessRx()
+  typedef struct { uint8_t command, len, data[DGUS_RX_FRAME_SIZE]; } rx_frame_t;
+  static rx_frame_t rx_frames[DGUS_RX_FRAMES];
+  static uint8_t rx_frame_head, rx_frame_count;
   static bool Initialized, no_reentrance;
 
   static DGUSLCD_Screens displayRequest;
+
+  #if ENABLED(DGUS_VP_SHADOW)
+    typedef struct { uint16_t vp, crc; bool valid; } vp_shadow_t;
+    static vp_shadow_t vp_shadow[DGUS_VP_SHADOW_SIZE];
+    static millis_t shadow_expire_ms;
+    static vp_shadow_t& FindShadow(const uint16_t vp);
+
+    static bool batching;
+    static uint16_t batch_adr;
+    static uint8_t batch_len, batch_buf[DGUS_BATCH_SIZE];
+    static void QueueWrite(const uint16_t adr, const uint8_t * const data, const uint8_t len);
+  #endif
 };
 
 extern DGUSDisplay dgusdisplay;
@@ -43,6 +43,10 @@ extern const struct VPMapping VPMap[];
 // List of VPs handled by Marlin / The Display.
 extern const struct DGUS_VP_Variable ListOfVP[];
 
+// ListOfVP entry numbers in PROGMEM, sorted by VP
+extern const uint16_t * const ListOfVPIndex;
+extern const uint16_t ListOfVPIndexSize;
+
 #define DWIN_DEFAULT_FILLER_CHAR ' '
 #define DWIN_SCROLLER_FILLER_CHAR 0x0
 
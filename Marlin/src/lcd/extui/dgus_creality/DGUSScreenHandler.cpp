@@ -1073,13 +1073,16 @@ const uint16_t* DGUSLCD_FindScreenVPMapList(uint8_t screen) {
 }
 
 const DGUS_VP_Variable* DGUSLCD_FindVPVar(const uint16_t vp) {
-  const DGUS_VP_Variable *ret = ListOfVP;
-  do {
-    const uint16_t vpcheck = pgm_read_word(&(ret->VP));
-    if (vpcheck == 0) break;
-    if (vpcheck == vp) return ret;
-    ++ret;
-  } while (1);
+  // Bisect for the first entry with this VP
+  uint16_t lo = 0, hi = ListOfVPIndexSize;
+  while (lo < hi) {
+    const uint16_t mid = (lo + hi) / 2;
+    if (pgm_read_word(&(ListOfVP[pgm_read_word(&ListOfVPIndex[mid])].VP)) < vp) lo = mid + 1; else hi = mid;
+  }
+  if (lo < ListOfVPIndexSize) {
+    const DGUS_VP_Variable *ret = &ListOfVP[pgm_read_word(&ListOfVPIndex[lo])];
+    if (pgm_read_word(&(ret->VP)) == vp) return ret;
+  }
 
   DEBUG_ECHOLNPGM("FindVPVar NOT FOUND ", vp);
   return nullptr;
@@ -1637,6 +1640,8 @@ void DGUSScreenHandler::UpdateScreenVPData() {
 
   //DEBUG_ECHOPGM(" UpdateScreenVPData Screen: ", current_screen);
 
+  TERN_(DGUS_VP_SHADOW, DGUSDisplay::Batch batch); // Skip unchanged VPs, merge adjacent ones
+
   const uint16_t *VPList = DGUSLCD_FindScreenVPMapList(current_screen);
   if (!VPList) {
     DEBUG_ECHOLNPGM(" NO SCREEN FOR: ", current_screen);
@@ -394,7 +394,7 @@ public:
   }
 
   /// Force an update of all VP on the current screen.
-  static inline void ForceCompleteUpdate() { update_ptr = 0; ScreenComplete = false; }
+  static inline void ForceCompleteUpdate() { update_ptr = 0; ScreenComplete = false; TERN_(DGUS_VP_SHADOW, dgusdisplay.ClearShadow()); }
   /// Has all VPs sent to the screen
   static inline bool IsScreenComplete() { return ScreenComplete; }
 
@@ -501,7 +501,7 @@ const struct VPMapping VPMap[] PROGMEM = {
 #define VPHELPER_STR(VPADR, VPADRVAR, STRLEN, RXFPTR, TXFPTR ) { .VP=VPADR, .memadr=VPADRVAR, .size=STRLEN, \
   .set_by_display_handler = RXFPTR, .send_to_display_handler = TXFPTR }
 
-const struct DGUS_VP_Variable ListOfVP[] PROGMEM = {
+constexpr struct DGUS_VP_Variable ListOfVP[] PROGMEM = {
   // Back button state
   VPHELPER(VP_BACK_BUTTON_STATE, nullptr, nullptr, ScreenHandler.SendBusyState),
 
@@ -817,4 +817,23 @@ const struct DGUS_VP_Variable ListOfVP[] PROGMEM = {
   VPHELPER(0, 0, 0, 0)  // must be last entry.
 };
 
+// ListOfVP entry numbers sorted by VP, so DGUSLCD_FindVPVar can bisect them.
+// Built at compile time. The sort is stable, so a duplicate VP finds its first entry.
+struct VPIndex { uint16_t entry[COUNT(ListOfVP) - 1]; }; // Without the terminator
+
+static constexpr VPIndex sort_vp_index() {
+  VPIndex index{};
+  for (uint16_t i = 0; i < COUNT(index.entry); ++i) {
+    uint16_t j = i;
+    for (; j && ListOfVP[index.entry[j - 1]].VP > ListOfVP[i].VP; --j)
+      index.entry[j] = index.entry[j - 1];
+    index.entry[j] = i;
+  }
+  return index;
+}
+
+static constexpr VPIndex vp_index PROGMEM = sort_vp_index();
+const uint16_t * const ListOfVPIndex = vp_index.entry;
+const uint16_t ListOfVPIndexSize = COUNT(vp_index.entry);
+
 #endif // DGUS_LCD_UI_ORIGIN
@@ -18,6 +18,10 @@
 
 #include "../../../../module/settings.h"
 
+#if ENABLED(BABYSTEP_MESH_FEEDBACK)
+#include "../../../../feature/babystep.h"
+#endif
+
 #include "../../ui_api.h"
 #include "../../../marlinui.h"
 
@@ -90,6 +94,7 @@ void LevelingModeHandler(DGUS_VP_Variable &var, unsigned short buttonValue) {
                 case 1:
                     probe.settings.static_z_offset = 0;                 //reset statis z-offset otherwise probing is faulty
                     probe.offset.z = 0;                                 //reset z-offset otherwise probing is faulty
+                    TERN_(BABYSTEP_MESH_FEEDBACK, babystep.clear_mesh_adjustments());
                     queue.enqueue_now_P("G28 U0");                      //home all axis
                     #if DISABLED (VYPER_NOZZLE_HOMING)
                         queue.enqueue_now_P("G0 Z5 F240");              //raise z
@@ -180,6 +185,7 @@ void LevelingModeHandler(DGUS_VP_Variable &var, unsigned short buttonValue) {
                 ExtUI::injectCommands_P("G28 U0\nG34\nG29 U0");
             #else
                 probe.offset.z = 0;                                 //reset z-offset, otherwise bedleveling is faulty
+                TERN_(BABYSTEP_MESH_FEEDBACK, babystep.clear_mesh_adjustments());
                 ExtUI::injectCommands_P("G28 U0\nG29 U0");          //home all axis, start bed leveling, U0 is for probe heaters function
             #endif
 #if HAS_MESH
@@ -74,9 +74,9 @@ void BedMeshEditScreen::onEntry() {
 }
 
 void BedMeshEditScreen::makeMeshValid() {
-  bed_mesh_t &mesh = ExtUI::getMeshArray();
   GRID_LOOP(x, y) {
-    if (isnan(mesh[x][y])) mesh[x][y] = 0;
+    const xy_uint8_t pos = { x, y };
+    if (isnan(ExtUI::getMeshPoint(pos))) ExtUI::setMeshPoint(pos, 0);
   }
 }
 
@@ -803,8 +803,10 @@ namespace ExtUI {
 
       #if ENABLED(BABYSTEP_ZPROBE_OFFSET)
         // Make it so babystepping in Z adjusts the Z probe offset.
-        if (axis == Z && TERN1(HAS_MULTI_EXTRUDER, (linked_nozzles || active_extruder == 0)))
+        if (axis == Z && TERN1(HAS_MULTI_EXTRUDER, (linked_nozzles || active_extruder == 0))) {
           probe.offset.z += mm;
+          TERN_(BABYSTEP_MESH_FEEDBACK, babystep.record_z_adjustment(mm));
+        }
       #endif
 
       #if HAS_MULTI_EXTRUDER && HAS_HOTEND_OFFSET
@@ -856,8 +858,10 @@ namespace ExtUI {
 
   void setZOffset_mm(const_float_t value) {
     #if HAS_BED_PROBE
-      if (WITHIN(value, Z_PROBE_OFFSET_RANGE_MIN, Z_PROBE_OFFSET_RANGE_MAX))
+      if (WITHIN(value, Z_PROBE_OFFSET_RANGE_MIN, Z_PROBE_OFFSET_RANGE_MAX)) {
         probe.offset.z = value;
+        TERN_(BABYSTEP_MESH_FEEDBACK, babystep.clear_mesh_adjustments());
+      }
     #elif ENABLED(BABYSTEP_DISPLAY_TOTAL)
       babystep.add_mm(Z_AXIS, value - getZOffset_mm());
     #else
@@ -926,7 +930,8 @@ namespace ExtUI {
       void setMeshPoint(const xy_uint8_t &pos, const_float_t zoff) {
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           bedlevel.z_values[pos.x][pos.y] = zoff;
-          TERN_(ABL_BILINEAR_SUBDIVISION, bedlevel.refresh_bed_level());
+          TERN_(BILINEAR_NEEDS_REFRESH, bedlevel.refresh_bed_level());
+          TERN_(BILINEAR_MESH_SLOTS, bedlevel.mesh_changed = true);
         }
       }
 
@@ -302,8 +302,10 @@ void scroll_screen(const uint8_t limit, const bool is_menu) {
 
         babystep.add_steps(Z_AXIS, babystep_increment);
 
-        if (do_probe)
+        if (do_probe) {
           probe.offset.z = new_offs;
+          TERN_(BABYSTEP_MESH_FEEDBACK, babystep.record_z_adjustment(diff));
+        }
         else
           TERN(BABYSTEP_HOTEND_Z_OFFSET, hotend_offset[active_extruder].z = new_offs, NOOP);
 
@@ -1043,6 +1043,17 @@ void Endstops::update() {
     } \
   }while(0)
 
+  #if ENABLED(CONCURRENT_XY_HOMING)
+    // Lock the axis at its endstop and end the move once every homing axis is locked
+    #define PROCESS_LOCKING_ENDSTOP(AXIS, MINMAX) do { \
+      if (TEST_ENDSTOP(_ENDSTOP(AXIS, MINMAX))) { \
+        _ENDSTOP_HIT(AXIS, MINMAX); \
+        if (stepper.lock_homing_axis(_AXIS(AXIS))) \
+          planner.endstop_triggered(_AXIS(AXIS)); \
+      } \
+    }while(0)
+  #endif
+
   // Core Sensorless Homing needs to test an Extra Pin
   #define CORE_DIAG(QQ,A,MM) (CORE_IS_##QQ && A##_SENSORLESS && !A##_SPI_SENSORLESS && HAS_##A##_##MM)
   #define PROCESS_CORE_ENDSTOP(A1,M1,A2,M2) do { \
@@ -1085,12 +1096,16 @@ void Endstops::update() {
 
   #if ENABLED(X_DUAL_ENDSTOPS)
     #define PROCESS_ENDSTOP_X(MINMAX) PROCESS_DUAL_ENDSTOP(X, MINMAX)
+  #elif ENABLED(CONCURRENT_XY_HOMING)
+    #define PROCESS_ENDSTOP_X(MINMAX) if (X_##MINMAX##_TEST()) PROCESS_LOCKING_ENDSTOP(X, MINMAX)
   #else
     #define PROCESS_ENDSTOP_X(MINMAX) if (X_##MINMAX##_TEST()) PROCESS_ENDSTOP(X, MINMAX)
   #endif
 
   #if ENABLED(Y_DUAL_ENDSTOPS)
     #define PROCESS_ENDSTOP_Y(MINMAX) PROCESS_DUAL_ENDSTOP(Y, MINMAX)
+  #elif ENABLED(CONCURRENT_XY_HOMING)
+    #define PROCESS_ENDSTOP_Y(MINMAX) PROCESS_LOCKING_ENDSTOP(Y, MINMAX)
   #else
     #define PROCESS_ENDSTOP_Y(MINMAX) PROCESS_ENDSTOP(Y, MINMAX)
   #endif
@@ -66,6 +66,10 @@
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(THERMAL_Z_MODEL)
+  #include "../feature/thermal_z_model.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
@@ -2294,6 +2298,162 @@ void prepare_line_to_destination() {
 
   } // homeaxis()
 
+  #if ENABLED(CONCURRENT_XY_HOMING)
+
+    /**
+     * Move X and Y together, each axis no faster than its given feedrate.
+     * Towards the endstops each axis is locked as soon as its endstop triggers
+     * while the other keeps going, and the move ends when both have stopped.
+     */
+    static void do_homing_move_xy(const xy_float_t &distance, const xy_feedrate_t &fr_mm_s, const bool is_home_dir) {
+      DEBUG_SECTION(log_move, "do_homing_move_xy", DEBUGGING(LEVELING));
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("...(", distance.x, ", ", distance.y, ")");
+
+      const float length = distance.magnitude();
+      if (!length) return;
+
+      #if ENABLED(SENSORLESS_HOMING)
+        sensorless_t stealth_states_x { false }, stealth_states_y { false };
+        if (is_home_dir) {
+          if (distance.x) stealth_states_x = start_sensorless_homing_per_axis(X_AXIS);
+          if (distance.y) stealth_states_y = start_sensorless_homing_per_axis(Y_AXIS);
+          #if SENSORLESS_STALLGUARD_DELAY
+            safe_delay(SENSORLESS_STALLGUARD_DELAY); // Short delay needed to settle
+          #endif
+        }
+      #endif
+
+      // The fastest diagonal feedrate that keeps each axis within its own
+      const feedRate_t fr_x = distance.x ? fr_mm_s.x * length / ABS(distance.x) : 0,
+                       fr_y = distance.y ? fr_mm_s.y * length / ABS(distance.y) : 0,
+                       fr = (fr_x && fr_y) ? _MIN(fr_x, fr_y) : (fr_x ?: fr_y);
+
+      // Pretend the current position is 0,0
+      abce_pos_t target = planner.get_axis_positions_mm();
+      target.x = target.y = 0;
+      planner.set_machine_position_mm(target);
+
+      #if HAS_DIST_MM_ARG
+        const xyze_float_t cart_dist_mm{0};
+      #endif
+
+      if (is_home_dir) stepper.set_homing_axes((distance.x ? _BV(X_AXIS) : 0) | (distance.y ? _BV(Y_AXIS) : 0));
+
+      target.x = distance.x;
+      target.y = distance.y;
+      planner.buffer_segment(target OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), fr, active_extruder);
+      planner.synchronize();
+
+      if (is_home_dir) {
+        stepper.set_homing_axes(0);
+
+        #if ENABLED(VALIDATE_HOMING_ENDSTOPS)
+          // Every axis that moved must have stopped at its endstop
+          const Endstops::endstop_mask_t hits = endstops.trigger_state();
+          if ((distance.x && !TEST(hits, X_ENDSTOP)) || (distance.y && !TEST(hits, Y_ENDSTOP)))
+            kill(GET_TEXT_F(MSG_KILL_HOMING_FAILED));
+        #endif
+        endstops.hit_on_purpose();
+
+        #if ENABLED(SENSORLESS_HOMING)
+          if (distance.x) end_sensorless_homing_per_axis(X_AXIS, stealth_states_x);
+          if (distance.y) end_sensorless_homing_per_axis(Y_AXIS, stealth_states_y);
+          #if SENSORLESS_STALLGUARD_DELAY
+            safe_delay(SENSORLESS_STALLGUARD_DELAY); // Short delay needed to settle
+          #endif
+        #endif
+      }
+    }
+
+    /**
+     * Home X and Y at the same time. The fast approach, the move away and
+     * the slow re-bump are each a single XY move in which every axis stops
+     * at its own endstop, so homing takes as long as the slower axis rather
+     * than the sum of both.
+     */
+    void homeaxes_xy() {
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM(">>> homeaxes_xy()");
+
+      const xy_float_t dir = { float(home_dir(X_AXIS)), float(home_dir(Y_AXIS)) };
+      const xy_feedrate_t home_fr = { homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS) };
+
+      //
+      // Back away to prevent an early sensorless trigger
+      //
+      #ifdef SENSORLESS_BACKOFF_MM
+        const xyz_float_t backoff = SENSORLESS_BACKOFF_MM;
+        const xy_float_t backoff_length = {
+          TERN0(X_SENSORLESS, -ABS(backoff.x) * dir.x),
+          TERN0(Y_SENSORLESS, -ABS(backoff.y) * dir.y)
+        };
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Sensorless backoff: ", backoff_length.x, ", ", backoff_length.y, "mm");
+        do_homing_move_xy(backoff_length, home_fr, false);
+      #endif
+
+      //
+      // Fast move towards both endstops until each is triggered
+      //
+      const xy_float_t move_length = { 1.5f * max_length(X_AXIS) * dir.x, 1.5f * max_length(Y_AXIS) * dir.y };
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Home Fast: ", move_length.x, ", ", move_length.y, "mm");
+      do_homing_move_xy(move_length, home_fr, true);
+
+      // If a second homing move is configured...
+      const xy_float_t bump = { home_bump_mm(X_AXIS) * dir.x, home_bump_mm(Y_AXIS) * dir.y };
+      if (bump.x || bump.y) {
+        // Move both away from their endstops by HOMING_BUMP_MM
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Move Away: ", -bump.x, ", ", -bump.y, "mm");
+        do_homing_move_xy(-bump, home_fr, false);
+
+        #if ENABLED(DETECT_BROKEN_ENDSTOP)
+          // Check for a broken endstop
+          const Endstops::endstop_mask_t es = endstops.state();
+          const bool bad_x = bump.x && TEST(es, X_ENDSTOP);
+          if (bad_x || (bump.y && TEST(es, Y_ENDSTOP))) {
+            SERIAL_ECHO_MSG("Bad ", AS_CHAR(bad_x ? 'X' : 'Y'), " Endstop?");
+            kill(GET_TEXT_F(MSG_KILL_HOMING_FAILED));
+          }
+        #endif
+
+        // Slow move towards both endstops until each is triggered
+        const xy_feedrate_t bump_fr = { get_homing_bump_feedrate(X_AXIS), get_homing_bump_feedrate(Y_AXIS) };
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Re-bump: ", bump.x * 2, ", ", bump.y * 2, "mm");
+        do_homing_move_xy(bump * 2, bump_fr, true);
+      }
+
+      #ifdef TMC_HOME_PHASE
+        // move back to homing phase if configured and capable
+        backout_to_tmc_homing_phase(X_AXIS);
+        backout_to_tmc_homing_phase(Y_AXIS);
+      #endif
+
+      set_axis_is_at_home(X_AXIS);
+      set_axis_is_at_home(Y_AXIS);
+      sync_plan_position();
+
+      destination.x = current_position.x;
+      destination.y = current_position.y;
+
+      if (DEBUGGING(LEVELING)) DEBUG_POS("> AFTER set_axis_is_at_home", current_position);
+
+      #ifdef HOMING_BACKOFF_POST_MM
+        const xyz_float_t endstop_backoff = HOMING_BACKOFF_POST_MM;
+        if (endstop_backoff.x || endstop_backoff.y) {
+          current_position.x -= ABS(endstop_backoff.x) * dir.x;
+          current_position.y -= ABS(endstop_backoff.y) * dir.y;
+          line_to_current_position(_MIN(home_fr.x, home_fr.y));
+
+          #if ENABLED(SENSORLESS_HOMING)
+            planner.synchronize();
+            safe_delay(200);  // Short delay to allow belts to spring back
+          #endif
+        }
+      #endif
+
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("<<< homeaxes_xy()");
+    }
+
+  #endif // CONCURRENT_XY_HOMING
+
 #endif // HAS_ENDSTOPS
 
 /**
@@ -2358,6 +2518,11 @@ void set_axis_is_at_home(const AxisEnum axis) {
 
   TERN_(BABYSTEP_DISPLAY_TOTAL, babystep.reset_total(axis));
 
+  // Thermal Z drift is measured from here
+  #if ENABLED(THERMAL_Z_MODEL)
+    if (axis == Z_AXIS) thermal_z.set_reference();
+  #endif
+
   #if HAS_POSITION_SHIFT
     position_shift[axis] = 0;
     update_workspace_offset(axis);
@@ -427,6 +427,9 @@ void set_axis_is_at_home(const AxisEnum axis);
    */
   extern main_axes_bits_t axes_homed, axes_trusted;
   void homeaxis(const AxisEnum axis);
+  #if ENABLED(CONCURRENT_XY_HOMING)
+    void homeaxes_xy();
+  #endif
   void set_axis_never_homed(const AxisEnum axis);
   main_axes_bits_t axes_should_home(main_axes_bits_t axes_mask=main_axes_mask);
   bool homing_needed_error(main_axes_bits_t axes_mask=main_axes_mask);
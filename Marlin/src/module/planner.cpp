@@ -803,10 +803,9 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   if (accel != 0) {
     inverse_accel = 1.0f / accel;
     const float half_inverse_accel = 0.5f * inverse_accel,
-                nominal_rate_sq = sq(float(block->nominal_rate)),
                 // Steps required for acceleration, deceleration to/from nominal rate
-                decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate)));
-          float accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
+                decelerate_steps_float = acceleration_distance(final_rate, block->nominal_rate, half_inverse_accel);
+          float accelerate_steps_float = acceleration_distance(initial_rate, block->nominal_rate, half_inverse_accel);
     accelerate_steps = CEIL(accelerate_steps_float);
     decelerate_steps = FLOOR(decelerate_steps_float);
 
@@ -818,7 +817,7 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
     // Calculate accel / braking time in order to reach the final_rate exactly
     // at the end of this block.
     if (plateau_steps < 0) {
-      accelerate_steps_float = CEIL((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
+      accelerate_steps_float = CEIL(intersection_distance(block->step_event_count, accelerate_steps_float, decelerate_steps_float));
       accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
       decelerate_steps = block->step_event_count - accelerate_steps;
 
@@ -1792,7 +1791,11 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(GCODE_PROFILER, const uint32_t start_us = micros());
+  while (busy()) idle();
+  TERN_(GCODE_PROFILER, profiler.blocked(micros() - start_us));
+}
 
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
@@ -2229,7 +2232,9 @@ bool Planner::_populate_block(
      * A correction function is permitted to add steps to an axis, it
      * should *never* remove steps!
      */
-    TERN_(BACKLASH_COMPENSATION, backlash.add_correction_steps(da, db, dc, dm, block));
+    #if ENABLED(BACKLASH_COMPENSATION) && DISABLED(BACKLASH_IN_STEPPER)
+      backlash.add_correction_steps(da, db, dc, dm, block);
+    #endif
   }
 
   TERN_(HAS_EXTRUDERS, block->steps.e = esteps);
@@ -3334,6 +3339,7 @@ void Planner::refresh_acceleration_rates() {
  */
 void Planner::refresh_positioning() {
   LOOP_DISTINCT_AXES(i) mm_per_step[i] = 1.0f / settings.axis_steps_per_mm[i];
+  TERN_(BACKLASH_IN_STEPPER, backlash.refresh_correction_steps());
   set_position_mm(current_position);
   refresh_acceleration_rates();
 }
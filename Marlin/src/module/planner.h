@@ -76,6 +76,10 @@
   #include "../feature/closedloop.h"
 #endif
 
+#if ENABLED(GCODE_PROFILER)
+  #include "../feature/gcode_profiler.h"
+#endif
+
 // Feedrate for manual moves
 #ifdef MANUAL_FEEDRATE
   constexpr xyze_feedrate_t _mf = MANUAL_FEEDRATE,
@@ -762,7 +766,15 @@ class Planner {
     FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
 
       // Wait until there are enough slots free
-      while (moves_free() < count) { idle(); }
+      #if ENABLED(GCODE_PROFILER)
+        if (moves_free() < count) {
+          const uint32_t start_us = micros();
+          while (moves_free() < count) { idle(); }
+          profiler.blocked(micros() - start_us);
+        }
+      #else
+        while (moves_free() < count) { idle(); }
+      #endif
 
       // Return the first available block
       next_buffer_head = next_block_index(block_buffer_head);
@@ -988,6 +1000,28 @@ class Planner {
       }
     #endif
 
+    /**
+     * Trapezoid math shared by calculate_trapezoid_for_block and the print time
+     * estimator. Distances and rates may be in steps or in mm, as long as they match.
+     */
+
+    // Distance to go from 'initial_rate' to 'target_rate' with 0.5 / acceleration
+    static float acceleration_distance(const_float_t initial_rate, const_float_t target_rate, const_float_t half_inverse_accel) {
+      return half_inverse_accel * (sq(target_rate) - sq(initial_rate));
+    }
+
+    // Distance to accelerate when the move is too short to reach the nominal rate
+    static float intersection_distance(const_float_t length, const_float_t accelerate_distance, const_float_t decelerate_distance) {
+      return (length + accelerate_distance - decelerate_distance) * 0.5f;
+    }
+
+    /**
+     * Calculate the speed reached given initial speed, acceleration and distance
+     */
+    static float final_speed(const_float_t initial_velocity, const_float_t accel, const_float_t distance) {
+      return SQRT(sq(initial_velocity) + 2 * accel * distance);
+    }
+
   private:
 
     #if ENABLED(AUTOTEMP)
@@ -1013,15 +1047,6 @@ class Planner {
       return target_velocity_sqr - 2 * accel * distance;
     }
 
-    #if EITHER(S_CURVE_ACCELERATION, LIN_ADVANCE)
-      /**
-       * Calculate the speed reached given initial speed, acceleration and distance
-       */
-      static float final_speed(const_float_t initial_velocity, const_float_t accel, const_float_t distance) {
-        return SQRT(sq(initial_velocity) + 2 * accel * distance);
-      }
-    #endif
-
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
 
     static void reverse_pass_kernel(block_t * const current, const block_t * const next OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
@@ -36,7 +36,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V88"
+#define EEPROM_VERSION "V90"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -141,6 +141,14 @@
   #include "../feature/probe_temp_comp.h"
 #endif
 
+#if ENABLED(THERMAL_Z_MODEL)
+  #include "../feature/thermal_z_model.h"
+#endif
+
+#if ENABLED(BABYSTEP_MESH_FEEDBACK)
+  #include "../feature/babystep.h"
+#endif
+
 #include "../feature/controllerfan.h"
 
 #if ENABLED(CASE_LIGHT_ENABLE)
@@ -314,6 +322,13 @@ typedef struct SettingsDataStruct {
     #endif
   #endif
 
+  //
+  // Thermal Z drift model
+  //
+  #if ENABLED(THERMAL_Z_MODEL)
+    thermal_z_settings_t thermal_z_settings;            // M1011 E B H
+  #endif
+
   //
   // BLTOUCH
   //
@@ -446,6 +461,9 @@ typedef struct SettingsDataStruct {
   per_stepper_uint32_t tmc_hybrid_threshold;            // M913 X Y Z...
   mot_stepper_int16_t tmc_sgt;                          // M914 X Y Z...
   per_stepper_bool_t tmc_stealth_enabled;               // M569 X Y Z...
+  #if ENABLED(TMC_HYBRID_TUNING)
+    chopper_timing_t tmc_chopper_timing[3];             // M1010 X Y Z, M919 X Y Z
+  #endif
 
   //
   // LIN_ADVANCE
@@ -643,6 +661,9 @@ void MarlinSettings::postprocess() {
 
   TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
 
+  // The mesh and probe offset were replaced
+  TERN_(BABYSTEP_MESH_FEEDBACK, babystep.clear_mesh_adjustments());
+
   TERN_(HAS_MOTOR_CURRENT_PWM, stepper.refresh_motor_power());
 
   TERN_(FWRETRACT, fwretract.refresh_autoretract());
@@ -991,7 +1012,7 @@ void MarlinSettings::postprocess() {
     {
       _FIELD_TEST(planner_leveling_active);
       const bool ubl_active = TERN(AUTO_BED_LEVELING_UBL, planner.leveling_active, false);
-      const int8_t storage_slot = TERN(AUTO_BED_LEVELING_UBL, bedlevel.storage_slot, -1);
+      const int8_t storage_slot = TERN(HAS_MESH_SLOTS, bedlevel.storage_slot, -1);
       EEPROM_WRITE(ubl_active);
       EEPROM_WRITE(storage_slot);
     }
@@ -1024,6 +1045,14 @@ void MarlinSettings::postprocess() {
       // No placeholder data for this feature
     #endif
 
+    //
+    // Thermal Z drift model
+    //
+    #if ENABLED(THERMAL_Z_MODEL)
+      _FIELD_TEST(thermal_z_settings);
+      EEPROM_WRITE(thermal_z.settings);
+    #endif
+
     //
     // BLTOUCH
     //
@@ -1447,6 +1476,19 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(tmc_stealth_enabled);
     }
 
+    //
+    // TMC chopper timing
+    //
+    #if ENABLED(TMC_HYBRID_TUNING)
+    {
+      _FIELD_TEST(tmc_chopper_timing);
+      LOOP_L_N(a, 3) {
+        const chopper_timing_t ct = tmc_get_chopper_times(AxisEnum(a));
+        EEPROM_WRITE(ct);
+      }
+    }
+    #endif
+
     //
     // Linear Advance
     //
@@ -1995,6 +2037,12 @@ void MarlinSettings::postprocess() {
         #endif
         EEPROM_READ(planner_leveling_active);
         EEPROM_READ(ubl_storage_slot);
+        #if ENABLED(BILINEAR_MESH_SLOTS)
+          if (!validating) {
+            bedlevel.storage_slot = ubl_storage_slot;
+            bedlevel.mesh_changed = false;
+          }
+        #endif
       }
 
       //
@@ -2028,6 +2076,18 @@ void MarlinSettings::postprocess() {
         // No placeholder data for this feature
       #endif
 
+      //
+      // Thermal Z drift model
+      //
+      #if ENABLED(THERMAL_Z_MODEL)
+      {
+        thermal_z_settings_t thermal_z_settings;
+        _FIELD_TEST(thermal_z_settings);
+        EEPROM_READ(thermal_z_settings);
+        if (!validating) thermal_z.settings = thermal_z_settings;
+      }
+      #endif
+
       //
       // BLTOUCH
       //
@@ -2464,6 +2524,18 @@ void MarlinSettings::postprocess() {
         #endif
       }
 
+      //
+      // TMC chopper timing
+      //
+      #if ENABLED(TMC_HYBRID_TUNING)
+      {
+        _FIELD_TEST(tmc_chopper_timing);
+        chopper_timing_t tmc_chopper_timing[3];
+        EEPROM_READ(tmc_chopper_timing);
+        if (!validating) LOOP_L_N(a, 3) tmc_set_chopper_times(AxisEnum(a), tmc_chopper_timing[a]);
+      }
+      #endif
+
       //
       // Linear Advance
       //
@@ -2840,7 +2912,7 @@ void MarlinSettings::postprocess() {
     return false;
   }
 
-  #if ENABLED(AUTO_BED_LEVELING_UBL)
+  #if HAS_MESH_SLOTS
 
     inline void ubl_invalid_slot(const int s) {
       DEBUG_ECHOLNPGM("?Invalid slot.\n", s, " mesh slots available.");
@@ -2858,10 +2930,15 @@ void MarlinSettings::postprocess() {
       return (datasize() + EEPROM_OFFSET + 32) & 0xFFF8;
     }
 
-    #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bedlevel.z_values))
+    #if ENABLED(AUTO_BED_LEVELING_UBL)
+      #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bedlevel.z_values))
+    #else
+      #define MESH_STORE_SIZE (sizeof(LevelingBilinear::mesh_slot_t) + sizeof(uint16_t)) // Mesh and its CRC
+    #endif
 
     uint16_t MarlinSettings::calc_num_meshes() {
-      return (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
+      const uint16_t start = meshes_start_index();
+      return start < meshes_end ? (meshes_end - start) / MESH_STORE_SIZE : 0;
     }
 
     int MarlinSettings::mesh_slot_offset(const int8_t slot) {
@@ -2898,14 +2975,39 @@ void MarlinSettings::postprocess() {
         if (status) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
         else        DEBUG_ECHOLNPGM("Mesh saved in slot ", slot);
 
-      #else
+      #elif ENABLED(BILINEAR_MESH_SLOTS)
+
+        const int16_t a = calc_num_meshes();
+        if (!WITHIN(slot, 0, a - 1)) {
+          ubl_invalid_slot(a);
+          return;
+        }
 
-        // Other mesh types
+        LevelingBilinear::mesh_slot_t mesh;
+        mesh.grid_spacing = bedlevel.grid_spacing;
+        mesh.grid_start = bedlevel.grid_start;
+        mesh.bed_temp = TERN0(HAS_HEATED_BED, thermalManager.degTargetBed());
+        COPY(mesh.z_values, bedlevel.z_values);
+
+        // The CRC follows the mesh, so empty or stale slots can be told apart
+        int pos = mesh_slot_offset(slot);
+        uint16_t crc = 0, crc_crc = 0;
+        persistentStore.access_start();
+        bool status = persistentStore.write_data(pos, (uint8_t*)&mesh, sizeof(mesh), &crc);
+        if (!status) status = persistentStore.write_data(pos, (uint8_t*)&crc, sizeof(crc), &crc_crc);
+        persistentStore.access_finish();
+
+        if (status) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
+        else {
+          bedlevel.storage_slot = slot;
+          bedlevel.mesh_changed = false;
+          DEBUG_ECHOLNPGM("Mesh saved in slot ", slot);
+        }
 
       #endif
     }
 
-    void MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
+    bool MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
 
@@ -2913,7 +3015,7 @@ void MarlinSettings::postprocess() {
 
         if (!WITHIN(slot, 0, a - 1)) {
           ubl_invalid_slot(a);
-          return;
+          return false;
         }
 
         int pos = mesh_slot_offset(slot);
@@ -2954,9 +3056,47 @@ void MarlinSettings::postprocess() {
 
         EEPROM_FINISH();
 
-      #else
+        return !status;
 
-        // Other mesh types
+      #elif ENABLED(BILINEAR_MESH_SLOTS)
+
+        const int16_t a = calc_num_meshes();
+        if (!WITHIN(slot, 0, a - 1)) {
+          ubl_invalid_slot(a);
+          return false;
+        }
+
+        LevelingBilinear::mesh_slot_t mesh;
+        int pos = mesh_slot_offset(slot);
+        uint16_t crc = 0, stored_crc, crc_crc = 0;
+        persistentStore.access_start();
+        bool status = persistentStore.read_data(pos, (uint8_t*)&mesh, sizeof(mesh), &crc, false);
+        if (!status) status = persistentStore.read_data(pos, (uint8_t*)&stored_crc, sizeof(stored_crc), &crc_crc, false);
+        persistentStore.access_finish();
+        status = status || crc != stored_crc || !mesh.grid_spacing.x;
+
+        if (status) {
+          // Scanning empty slots is expected, so only complain about a requested load
+          if (!into) SERIAL_ECHOLNPGM("?Unable to load mesh data.");
+          return false;
+        }
+
+        if (into)
+          *(LevelingBilinear::mesh_slot_t*)into = mesh;
+        else {
+          bedlevel.set_grid(mesh.grid_spacing, mesh.grid_start);
+          COPY(bedlevel.z_values, mesh.z_values);
+          bedlevel.refresh_bed_level();
+          bedlevel.storage_slot = slot;
+          bedlevel.mesh_changed = false;
+          TERN_(THERMAL_Z_MODEL, thermal_z.set_mesh_reference());
+          TERN_(BABYSTEP_MESH_FEEDBACK, babystep.clear_mesh_adjustments());
+          #if ENABLED(EXTENSIBLE_UI)
+            GRID_LOOP(x, y) ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]);
+          #endif
+          DEBUG_ECHOLNPGM("Mesh loaded from slot ", slot);
+        }
+        return true;
 
       #endif
     }
@@ -2964,7 +3104,7 @@ void MarlinSettings::postprocess() {
     //void MarlinSettings::delete_mesh() { return; }
     //void MarlinSettings::defrag_meshes() { return; }
 
-  #endif // AUTO_BED_LEVELING_UBL
+  #endif // HAS_MESH_SLOTS
 
 #else // !EEPROM_SETTINGS
 
@@ -3153,6 +3293,11 @@ void MarlinSettings::reset() {
   //
   TERN_(HAS_PTC, ptc.reset());
 
+  //
+  // Thermal Z drift model
+  //
+  TERN_(THERMAL_Z_MODEL, thermal_z.reset());
+
   //
   // BLTouch
   //
@@ -3815,6 +3960,11 @@ void MarlinSettings::reset() {
     //
     TERN_(BACKLASH_GCODE, gcode.M425_report(forReplay));
 
+    //
+    // Thermal Z drift model
+    //
+    TERN_(THERMAL_Z_MODEL, gcode.M1011_report(forReplay));
+
     //
     // Filament Runout Sensor
     //
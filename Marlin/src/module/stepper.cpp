@@ -105,6 +105,10 @@ Stepper stepper; // Singleton
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+  #include "../feature/backlash.h"
+#endif
+
 #if MB(ALLIGATOR)
   #include "../feature/dac/dac_dac084s085.h"
 #endif
@@ -188,6 +192,10 @@ bool Stepper::abort_current_block;
   ;
 #endif
 
+#if ENABLED(CONCURRENT_XY_HOMING)
+  axis_bits_t Stepper::homing_axes, Stepper::homing_locked;
+#endif
+
 uint32_t Stepper::acceleration_time, Stepper::deceleration_time;
 uint8_t Stepper::steps_per_isr;
 
@@ -258,6 +266,10 @@ uint32_t Stepper::advance_divisor = 0,
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+  uint32_t Stepper::nextBacklashISR = BACKLASH_NEVER;
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
@@ -1505,6 +1517,11 @@ void Stepper::isr() {
       if (is_babystep) nextBabystepISR = babystepping_isr();
     #endif
 
+    #if ENABLED(BACKLASH_IN_STEPPER)
+      // 0 = Do backlash correction pulses, but never in the same pass as axis pulses
+      if (!nextBacklashISR && nextMainISR) nextBacklashISR = backlash_isr();
+    #endif
+
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
     if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
@@ -1517,6 +1534,11 @@ void Stepper::isr() {
         NOLESS(nextBabystepISR, nextMainISR / 2);       // TODO: Only look at axes enabled for baby-stepping
     #endif
 
+    #if ENABLED(BACKLASH_IN_STEPPER)
+      if (nextBacklashISR != BACKLASH_NEVER)            // Keep correction steps away from axis stepping
+        NOLESS(nextBacklashISR, nextMainISR / 2);
+    #endif
+
     // Get the interval to the next ISR call
     const uint32_t interval = _MIN(
       uint32_t(HAL_TIMER_TYPE_MAX),                           // Come back in a very long time
@@ -1525,6 +1547,7 @@ void Stepper::isr() {
       OPTARG(INPUT_SHAPING_Y, ShapingQueue::peek_y())         // Time until next input shaping echo for Y
       OPTARG(LIN_ADVANCE, nextAdvanceISR)                     // Come back early for Linear Advance?
       OPTARG(INTEGRATED_BABYSTEPPING, nextBabystepISR)        // Come back early for Babystepping?
+      OPTARG(BACKLASH_IN_STEPPER, nextBacklashISR)            // Come back early for Backlash correction?
     );
 
     //
@@ -1538,6 +1561,7 @@ void Stepper::isr() {
     TERN_(HAS_SHAPING, ShapingQueue::decrement_delays(interval));
     TERN_(LIN_ADVANCE, if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval);
     TERN_(INTEGRATED_BABYSTEPPING, if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval);
+    TERN_(BACKLASH_IN_STEPPER, if (nextBacklashISR != BACKLASH_NEVER) nextBacklashISR -= interval);
 
     /**
      * This needs to avoid a race-condition caused by interleaving
@@ -1877,6 +1901,14 @@ void Stepper::pulse_phase_isr() {
         #endif
       #endif
 
+      #if ENABLED(CONCURRENT_XY_HOMING)
+        // An axis already stopped at its endstop sits out the rest of the homing move
+        if (homing_locked) {
+          if (TEST(homing_locked, X_AXIS)) step_needed.x = false;
+          if (TEST(homing_locked, Y_AXIS)) step_needed.y = false;
+        }
+      #endif
+
       #if HAS_SHAPING
         // record an echo if a step is needed in the primary bresenham
         const bool x_step = TERN0(INPUT_SHAPING_X, shaping_x.enabled && step_needed[X_AXIS]),
@@ -2514,6 +2546,12 @@ uint32_t Stepper::block_phase_isr() {
       advance_dividend = (current_block->steps << 1).asLong();
       advance_divisor = step_event_count << 1;
 
+      #if ENABLED(BACKLASH_IN_STEPPER)
+        // Queue correction steps for axes reversing in this block
+        if (backlash.queue_correction_steps(current_block) && nextBacklashISR == BACKLASH_NEVER)
+          nextBacklashISR = 0;
+      #endif
+
       #if ENABLED(INPUT_SHAPING_X)
         if (shaping_x.enabled) {
           const int64_t steps = TEST(current_block->direction_bits, X_AXIS) ? -int64_t(current_block->steps.x) : int64_t(current_block->steps.x);
@@ -2672,6 +2710,47 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif
 
+#if ENABLED(BACKLASH_IN_STEPPER)
+
+  // Timer interrupt for backlash correction. Steps go in the direction
+  // already set for the current block and aren't counted in the position.
+  uint32_t Stepper::backlash_isr() {
+    const axis_bits_t step_bits = backlash.next_correction_steps(last_direction_bits);
+    if (!step_bits) return BACKLASH_NEVER;
+
+    #define BACKLASH_PULSE(AXIS, ON) do{ if (TEST(step_bits, _AXIS(AXIS))) { AXIS##_APPLY_STEP((ON) != INVERT_##AXIS##_STEP_PIN, true); } }while(0)
+    #define BACKLASH_PULSES(ON) do{ \
+      TERN_(HAS_X_STEP, BACKLASH_PULSE(X, ON)); \
+      TERN_(HAS_Y_STEP, BACKLASH_PULSE(Y, ON)); \
+      TERN_(HAS_Z_STEP, BACKLASH_PULSE(Z, ON)); \
+      TERN_(HAS_I_STEP, BACKLASH_PULSE(I, ON)); \
+      TERN_(HAS_J_STEP, BACKLASH_PULSE(J, ON)); \
+      TERN_(HAS_K_STEP, BACKLASH_PULSE(K, ON)); \
+      TERN_(HAS_U_STEP, BACKLASH_PULSE(U, ON)); \
+      TERN_(HAS_V_STEP, BACKLASH_PULSE(V, ON)); \
+      TERN_(HAS_W_STEP, BACKLASH_PULSE(W, ON)); \
+    }while(0)
+
+    // Set the STEP pulses ON
+    BACKLASH_PULSES(true);
+
+    TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
+
+    // Enforce a minimum duration for STEP pulse ON
+    #if ISR_PULSE_CONTROL
+      USING_TIMED_PULSE();
+      START_TIMED_PULSE();
+      AWAIT_HIGH_PULSE();
+    #endif
+
+    // Set the STEP pulses OFF
+    BACKLASH_PULSES(false);
+
+    return BACKLASH_STEP_TICKS;
+  }
+
+#endif
+
 // Check if the given block is busy or not - Must not be called from ISR contexts
 // The current_block could change in the middle of the read by an Stepper ISR, so
 // we must explicitly prevent that!
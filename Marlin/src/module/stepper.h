@@ -527,6 +527,11 @@ class Stepper {
                   ;
     #endif
 
+    #if ENABLED(CONCURRENT_XY_HOMING)
+      static axis_bits_t homing_axes,       // Axes approaching their endstops together
+                         homing_locked;     // Homing axes already stopped at their endstop
+    #endif
+
     static uint32_t acceleration_time, deceleration_time; // time measured in Stepper Timer ticks
     static uint8_t steps_per_isr;         // Count of steps to perform per Stepper ISR call
 
@@ -586,6 +591,11 @@ class Stepper {
       static uint32_t nextBabystepISR;
     #endif
 
+    #if ENABLED(BACKLASH_IN_STEPPER)
+      static constexpr uint32_t BACKLASH_NEVER = 0xFFFFFFFF;
+      static uint32_t nextBacklashISR;
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static page_step_state_t page_step_state;
     #endif
@@ -651,6 +661,11 @@ class Stepper {
       }
     #endif
 
+    #if ENABLED(BACKLASH_IN_STEPPER)
+      // The backlash correction ISR phase
+      static uint32_t backlash_isr();
+    #endif
+
     // Check if the given block is busy or not - Must not be called from ISR contexts
     static bool is_block_busy(const block_t * const block);
 
@@ -727,6 +742,16 @@ class Stepper {
       FORCE_INLINE static void set_y_lock(const bool state) { locked_Y_motor = state; }
       FORCE_INLINE static void set_y2_lock(const bool state) { locked_Y2_motor = state; }
     #endif
+    #if ENABLED(CONCURRENT_XY_HOMING)
+      // Begin (or with 0, end) a move in which each of the given axes stops at its own endstop
+      FORCE_INLINE static void set_homing_axes(const axis_bits_t axes) { homing_locked = 0; homing_axes = axes; }
+      // Stop stepping an axis at its endstop. Return true once every homing axis has stopped.
+      FORCE_INLINE static bool lock_homing_axis(const AxisEnum axis) {
+        if (!TEST(homing_axes, axis)) return true;
+        SBI(homing_locked, axis);
+        return homing_locked == homing_axes;
+      }
+    #endif
     #if EITHER(Z_MULTI_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
       FORCE_INLINE static void set_z1_lock(const bool state) { locked_Z_motor = state; }
       FORCE_INLINE static void set_z2_lock(const bool state) { locked_Z2_motor = state; }
@@ -56,6 +56,10 @@
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(PRINT_TIME_ESTIMATOR)
+  #include "../feature/print_time_estimator.h"
+#endif
+
 #define DEBUG_OUT EITHER(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -77,6 +81,11 @@ IF_DISABLED(NO_SD_AUTOSTART, uint8_t CardReader::autofile_index); // = 0
   serial_index_t IF_DISABLED(HAS_MULTI_SERIAL, constexpr) CardReader::transfer_port_index;
 #endif
 
+#if ENABLED(ABL_ADAPTIVE_MESH)
+  xy_pos_t CardReader::print_area_min { NAN, NAN },
+           CardReader::print_area_max { NAN, NAN };
+#endif
+
 // private:
 
 MediaFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_DIR_DEPTH];
@@ -499,7 +508,10 @@ void CardReader::manage_media() {
   prev_stat = stat;                 // Change now to prevent re-entry in safe_delay
 
   if (stat) {                       // Media Inserted
-    safe_delay(500);                // Some boards need a delay to get settled
+    // Some boards need a delay to get settled. At boot the media has been
+    // powered since reset, so only wait out what's left of the delay.
+    const millis_t settle_ms = old_stat != 2 ? 500UL : millis() < 500UL ? 500UL - millis() : 0UL;
+    safe_delay(settle_ms);
 
     // Try to mount the media (only later with SD_IGNORE_AT_STARTUP)
     if (TERN1(SD_IGNORE_AT_STARTUP, old_stat != 2)) mount();
@@ -691,6 +703,9 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
     filesize = file.fileSize();
     sdpos = 0;
 
+    TERN_(ABL_ADAPTIVE_MESH, if (subcall_type == 0) scan_print_area());
+    TERN_(PRINT_TIME_ESTIMATOR, if (subcall_type == 0) print_estimator.start());
+
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
       SERIAL_ECHOLNPGM(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -704,6 +719,44 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
     openFailed(fname);
 }
 
+#if ENABLED(ABL_ADAPTIVE_MESH)
+
+  /**
+   * Look for the print area in the header comments of the open file.
+   * Cura writes ";MINX:", ";MINY:", ";MAXX:" and ";MAXY:" near the top.
+   * Only the first ADAPTIVE_MESH_HEADER_SIZE bytes are scanned.
+   */
+  void CardReader::scan_print_area() {
+    print_area_min.set(NAN, NAN);
+    print_area_max.set(NAN, NAN);
+
+    char line[24];
+    uint8_t len = 0;
+    for (uint16_t n = 0; n < (ADAPTIVE_MESH_HEADER_SIZE); ++n) {
+      const int16_t c = file.read();
+      if (c < 0) break;
+      if (c == '\n' || c == '\r') {
+        line[len] = '\0';
+        if (len > 5 && line[0] == ';' && line[4] == ':') {
+          const float v = strtof(&line[5], nullptr);
+          if      (!strncmp_P(&line[1], PSTR("MINX"), 4)) print_area_min.x = v;
+          else if (!strncmp_P(&line[1], PSTR("MINY"), 4)) print_area_min.y = v;
+          else if (!strncmp_P(&line[1], PSTR("MAXX"), 4)) print_area_max.x = v;
+          else if (!strncmp_P(&line[1], PSTR("MAXY"), 4)) print_area_max.y = v;
+        }
+        len = 0;
+      }
+      else if (len < COUNT(line) - 1)
+        line[len++] = c;
+    }
+    file.seekSet(0);
+
+    if (has_print_area())
+      SERIAL_ECHOLNPGM("Print area X", print_area_min.x, ":", print_area_max.x, " Y", print_area_min.y, ":", print_area_max.y);
+  }
+
+#endif
+
 inline void echo_write_to_file(const char * const fname) {
   SERIAL_ECHOLNPGM(STR_SD_WRITE_TO_FILE, fname);
 }
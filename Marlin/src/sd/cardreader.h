@@ -143,6 +143,14 @@ public:
   static bool fileExists(const char * const name);
   static void removeFile(const char * const name);
 
+  #if ENABLED(ABL_ADAPTIVE_MESH)
+    // Print area read from the file header, used by G29 A
+    static xy_pos_t print_area_min, print_area_max;
+    static bool has_print_area() { // (false if any value is NAN)
+      return print_area_max.x > print_area_min.x && print_area_max.y > print_area_min.y;
+    }
+  #endif
+
   static char* longest_filename() { return longFilename[0] ? longFilename : filename; }
   #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
     static void printLongPath(char * const path);   // Used by M33
@@ -352,6 +360,10 @@ private:
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
   #endif
+
+  #if ENABLED(ABL_ADAPTIVE_MESH)
+    static void scan_print_area();
+  #endif
 };
 
 #if ENABLED(USB_FLASH_DRIVE_SUPPORT)